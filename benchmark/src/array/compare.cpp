@@ -0,0 +1,76 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit_array.hpp>           // bit_array
+#include <benchmark/benchmark.h>        // DoNotOptimize, BENCHMARK_TEMPLATE, BENCHMARK_MAIN
+#include <algorithm>                    // lexicographical_compare_three_way
+#include <cstddef>                      // size_t
+#include <cstdint>                      // int64_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+#include <utility>                      // pair
+#include <vector>                       // vector
+
+// bit_array's <=> (one pass over the blocks up to the first differing one)
+// against std::lexicographical_compare_three_way over its iterators (one
+// step per index up to the first differing one), on pairs of random arrays
+// that differ in a single index. Every benchmark reports comparisons per
+// second as items per second.
+
+namespace {
+
+constexpr auto num_pairs = 4096uz;
+
+template<std::size_t N>
+auto make_pairs()
+{
+        auto urbg = std::mt19937_64();
+        auto pairs = std::vector<std::pair<xstd::bit_array<N>, xstd::bit_array<N>>>();
+        for ([[maybe_unused]] auto _ : std::views::iota(0uz, num_pairs)) {
+                auto x = xstd::bit_array<N>();
+                for (auto i : std::views::iota(0uz, N)) {
+                        if (urbg() % 2) {
+                                x.m_bits.set(i);
+                        }
+                }
+                auto y = x;
+                y.m_bits.flip(urbg() % N);
+                pairs.emplace_back(x, y);
+        }
+        return pairs;
+}
+
+}       // namespace
+
+template<std::size_t N>
+static void bm_iterators(benchmark::State& state) {
+        auto const pairs = make_pairs<N>();
+        for (auto _ : state) {
+                for (auto const& [x, y] : pairs) {
+                        benchmark::DoNotOptimize(std::lexicographical_compare_three_way(x.begin(), x.end(), y.begin(), y.end()) < 0);
+                }
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_pairs));
+}
+
+template<std::size_t N>
+static void bm_blocks(benchmark::State& state) {
+        auto const pairs = make_pairs<N>();
+        for (auto _ : state) {
+                for (auto const& [x, y] : pairs) {
+                        benchmark::DoNotOptimize(x < y);
+                }
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_pairs));
+}
+
+BENCHMARK_TEMPLATE(bm_iterators,   64);
+BENCHMARK_TEMPLATE(bm_blocks,      64);
+BENCHMARK_TEMPLATE(bm_iterators,  256);
+BENCHMARK_TEMPLATE(bm_blocks,     256);
+BENCHMARK_TEMPLATE(bm_iterators, 1024);
+BENCHMARK_TEMPLATE(bm_blocks,    1024);
+
+BENCHMARK_MAIN();
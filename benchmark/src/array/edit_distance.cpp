@@ -0,0 +1,105 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <opt/array/edit_distance.hpp>  // edit_distance_pattern
+#include <benchmark/benchmark.h>        // DoNotOptimize, BENCHMARK_TEMPLATE, BENCHMARK_MAIN
+#include <algorithm>                    // min
+#include <cstddef>                      // size_t
+#include <cstdint>                      // int64_t
+#include <random>                       // mt19937_64
+#include <string>                       // string
+#include <string_view>                  // string_view
+#include <utility>                      // pair
+#include <vector>                       // vector
+
+// Every benchmark reports dynamic programming cells per second as items per second.
+
+namespace {
+
+// Two lines of the same length that differ in about one character in ten.
+auto similar_lines(std::size_t size)
+{
+        auto urbg = std::mt19937_64();
+        auto lhs = std::string(size, ' ');
+        for (auto& c : lhs) {
+                c = static_cast<char>('a' + urbg() % 26);
+        }
+        auto rhs = lhs;
+        for (auto& c : rhs) {
+                if (urbg() % 10 == 0) {
+                        c = static_cast<char>('a' + urbg() % 26);
+                }
+        }
+        return std::pair{ lhs, rhs };
+}
+
+auto scalar_distance(std::string_view pattern, std::string_view text)
+{
+        auto column = std::vector<std::size_t>(pattern.size() + 1);
+        for (auto i = 0uz; i < column.size(); ++i) {
+                column[i] = i;
+        }
+        for (auto j = 0uz; j < text.size(); ++j) {
+                auto diagonal = column[0];
+                column[0] = j + 1;
+                for (auto i = 1uz; i < column.size(); ++i) {
+                        auto const up = column[i];
+                        column[i] = std::min({ up + 1, column[i - 1] + 1, diagonal + (pattern[i - 1] != text[j]) });
+                        diagonal = up;
+                }
+        }
+        return column.back();
+}
+
+}       // namespace
+
+template<std::size_t N>
+static void bm_distance(benchmark::State& state) {
+        auto const [ lhs, rhs ] = similar_lines(N);
+        auto const pattern = xstd::edit_distance_pattern<N>(lhs);
+        for (auto _ : state) {
+                benchmark::DoNotOptimize(pattern.distance(rhs));
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(N * N));
+}
+
+template<std::size_t N>
+static void bm_distance_bounded(benchmark::State& state) {
+        auto const [ lhs, rhs ] = similar_lines(N);
+        auto const pattern = xstd::edit_distance_pattern<N>(lhs);
+        for (auto _ : state) {
+                benchmark::DoNotOptimize(pattern.distance(rhs, N / 20));
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(N * N));
+}
+
+template<std::size_t N>
+static void bm_scalar_distance(benchmark::State& state) {
+        auto const [ lhs, rhs ] = similar_lines(N);
+        for (auto _ : state) {
+                benchmark::DoNotOptimize(scalar_distance(lhs, rhs));
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(N * N));
+}
+
+template<std::size_t N>
+static void bm_search(benchmark::State& state) {
+        auto const [ lhs, rhs ] = similar_lines(64 * N);
+        auto const pattern = xstd::edit_distance_pattern<N>(std::string_view(rhs).substr(32 * N, N));
+        for (auto _ : state) {
+                benchmark::DoNotOptimize(pattern.search(lhs, N / 10));
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(64 * N * N));
+}
+
+BENCHMARK_TEMPLATE(bm_distance,          64);
+BENCHMARK_TEMPLATE(bm_distance,         512);
+BENCHMARK_TEMPLATE(bm_distance_bounded, 512);
+BENCHMARK_TEMPLATE(bm_scalar_distance,   64);
+BENCHMARK_TEMPLATE(bm_scalar_distance,  512);
+BENCHMARK_TEMPLATE(bm_search,           128);
+BENCHMARK_TEMPLATE(bm_search,           512);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,98 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bloom_filter.hpp>        // blocked_bloom_filter, bloom_filter
+#include <benchmark/benchmark.h>        // DoNotOptimize, BENCHMARK_TEMPLATE, BENCHMARK_MAIN
+#include <algorithm>                    // copy
+#include <cstddef>                      // size_t
+#include <cstdint>                      // int64_t, uint64_t
+#include <memory>                       // make_unique
+#include <random>                       // mt19937_64
+#include <vector>                       // vector
+
+// Filters of 8 MiB at 10 bits per key, far larger than the caches, queried
+// with half members and half random hashes. Every benchmark reports queries
+// per second as items per second.
+
+namespace {
+
+constexpr auto num_bits = 1uz << 26;
+
+auto random_hashes(std::size_t n, std::uint64_t seed)
+{
+        auto urbg = std::mt19937_64(seed);
+        auto hashes = std::vector<std::uint64_t>(n);
+        for (auto& h : hashes) {
+                h = urbg();
+        }
+        return hashes;
+}
+
+template<class F>
+auto make_filter()
+{
+        auto filter = std::make_unique<F>();
+        filter->insert_many(random_hashes(num_bits / 10, 1));
+        return filter;
+}
+
+auto make_queries()
+{
+        auto queries = random_hashes(1uz << 16, 1);
+        auto const others = random_hashes(1uz << 15, 2);
+        std::copy(others.begin(), others.end(), queries.begin() + (1uz << 15));
+        return queries;
+}
+
+}       // namespace
+
+template<class F>
+static void bm_contains(benchmark::State& state) {
+        auto const filter = make_filter<F>();
+        auto const queries = make_queries();
+        for (auto _ : state) {
+                auto count = 0uz;
+                for (auto h : queries) {
+                        count += filter->contains(h);
+                }
+                benchmark::DoNotOptimize(count);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(queries.size()));
+}
+
+template<class F>
+static void bm_contains_many(benchmark::State& state) {
+        auto const filter = make_filter<F>();
+        auto const queries = make_queries();
+        auto results = std::vector<bool>(queries.size());
+        for (auto _ : state) {
+                filter->contains_many(queries, results.begin());
+                benchmark::DoNotOptimize(results);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(queries.size()));
+}
+
+template<class F>
+static void bm_insert_many(benchmark::State& state) {
+        auto filter = std::make_unique<F>();
+        auto const hashes = make_queries();
+        for (auto _ : state) {
+                filter->insert_many(hashes);
+                benchmark::DoNotOptimize(*filter);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(hashes.size()));
+}
+
+using classic = xstd::bloom_filter<num_bits, 7>;
+using blocked = xstd::blocked_bloom_filter<num_bits, 7>;
+
+BENCHMARK_TEMPLATE(bm_contains,      classic);
+BENCHMARK_TEMPLATE(bm_contains,      blocked);
+BENCHMARK_TEMPLATE(bm_contains_many, classic);
+BENCHMARK_TEMPLATE(bm_contains_many, blocked);
+BENCHMARK_TEMPLATE(bm_insert_many,   classic);
+BENCHMARK_TEMPLATE(bm_insert_many,   blocked);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,113 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit_grid.hpp>            // bit_grid, direction, fill, flood_fill
+#include <benchmark/benchmark.h>        // DoNotOptimize, BENCHMARK_TEMPLATE1, BENCHMARK_MAIN
+#include <cstddef>                      // size_t
+#include <cstdint>                      // uint64_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+
+template<class G>
+static auto random_grid(auto& urbg, unsigned density)
+{
+        G g;
+        for (auto y : std::views::iota(0uz, G::height)) {
+                for (auto x : std::views::iota(0uz, G::width)) {
+                        if (urbg() % 8 < density) {
+                                g.insert(x, y);
+                        }
+                }
+        }
+        return g;
+}
+
+// The single-step loop that the Kogge-Stone fill replaces.
+template<xstd::direction D, class G>
+static auto iterative_fill(G generators, G const& empty)
+{
+        for (auto step = generators; not step.empty();) {
+                step = step.template shift<D>(empty) - generators;
+                generators |= step;
+        }
+        return generators;
+}
+
+template<class G>
+static auto iterative_flood_fill(G const& seed, G const& passable)
+{
+        auto filled = seed & passable;
+        for (auto frontier = filled; not frontier.empty();) {
+                frontier = (
+                        frontier.template shift<xstd::direction::north>(passable) |
+                        frontier.template shift<xstd::direction::east >(passable) |
+                        frontier.template shift<xstd::direction::south>(passable) |
+                        frontier.template shift<xstd::direction::west >(passable)
+                ) - filled;
+                filled |= frontier;
+        }
+        return filled;
+}
+
+// Rook-like slides from a few generators over a mostly empty board.
+template<class G>
+static void bm_iterative_fill(benchmark::State& state) {
+        auto urbg = std::mt19937_64();
+        auto const empty = random_grid<G>(urbg, 7);
+        auto const generators = random_grid<G>(urbg, 1) - empty;
+        for (auto _ : state) {
+                benchmark::DoNotOptimize(iterative_fill<xstd::direction::north_east>(generators, empty));
+        }
+}
+
+template<class G>
+static void bm_fill(benchmark::State& state) {
+        auto urbg = std::mt19937_64();
+        auto const empty = random_grid<G>(urbg, 7);
+        auto const generators = random_grid<G>(urbg, 1) - empty;
+        for (auto _ : state) {
+                benchmark::DoNotOptimize(fill<xstd::direction::north_east>(generators, empty));
+        }
+}
+
+// A maze-like board, just above the site percolation threshold.
+template<class G>
+static void bm_iterative_flood_fill(benchmark::State& state) {
+        auto urbg = std::mt19937_64();
+        auto const passable = random_grid<G>(urbg, 5);
+        auto const seed = G::row(0);
+        for (auto _ : state) {
+                benchmark::DoNotOptimize(iterative_flood_fill(seed, passable));
+        }
+}
+
+template<class G>
+static void bm_flood_fill(benchmark::State& state) {
+        auto urbg = std::mt19937_64();
+        auto const passable = random_grid<G>(urbg, 5);
+        auto const seed = G::row(0);
+        for (auto _ : state) {
+                benchmark::DoNotOptimize(flood_fill(seed, passable));
+        }
+}
+
+using board8  = xstd::bit_grid< 8,  8, std::uint64_t>;
+using board19 = xstd::bit_grid<19, 19, std::uint64_t, 1>;
+using board64 = xstd::bit_grid<64, 64, std::uint64_t>;
+
+BENCHMARK_TEMPLATE1(bm_iterative_fill,       board8);
+BENCHMARK_TEMPLATE1(bm_iterative_fill,       board19);
+BENCHMARK_TEMPLATE1(bm_iterative_fill,       board64);
+BENCHMARK_TEMPLATE1(bm_fill,                 board8);
+BENCHMARK_TEMPLATE1(bm_fill,                 board19);
+BENCHMARK_TEMPLATE1(bm_fill,                 board64);
+BENCHMARK_TEMPLATE1(bm_iterative_flood_fill, board8);
+BENCHMARK_TEMPLATE1(bm_iterative_flood_fill, board19);
+BENCHMARK_TEMPLATE1(bm_iterative_flood_fill, board64);
+BENCHMARK_TEMPLATE1(bm_flood_fill,           board8);
+BENCHMARK_TEMPLATE1(bm_flood_fill,           board19);
+BENCHMARK_TEMPLATE1(bm_flood_fill,           board64);
+
+BENCHMARK_MAIN();
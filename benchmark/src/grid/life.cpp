@@ -0,0 +1,64 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <opt/grid/life.hpp>            // life_step, life_world
+#include <xstd/bit_grid.hpp>            // bit_grid
+#include <benchmark/benchmark.h>        // ClobberMemory, DoNotOptimize, BENCHMARK_TEMPLATE, BENCHMARK_MAIN
+#include <cstddef>                      // size_t
+#include <cstdint>                      // int64_t, uint64_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+
+// Every benchmark reports cells per second as items per second.
+
+template<class G>
+static void bm_life_step(benchmark::State& state) {
+        auto urbg = std::mt19937_64();
+        G g;
+        for (auto y : std::views::iota(0uz, G::height)) {
+                for (auto x : std::views::iota(0uz, G::width)) {
+                        if (urbg() % 3 == 0) {
+                                g.insert(x, y);
+                        }
+                }
+        }
+        for (auto _ : state) {
+                g = xstd::life_step(g);
+                benchmark::DoNotOptimize(g);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(G::width * G::height));
+}
+
+template<class G, std::size_t TilesX, std::size_t TilesY>
+static void bm_life_world(benchmark::State& state) {
+        auto urbg = std::mt19937_64();
+        auto world = xstd::life_world<G>(TilesX, TilesY);
+        for (auto y : std::views::iota(0uz, world.height())) {
+                for (auto x : std::views::iota(0uz, world.width())) {
+                        if (urbg() % 3 == 0) {
+                                world.insert(x, y);
+                        }
+                }
+        }
+        for (auto _ : state) {
+                world.step();
+                benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(world.width() * world.height()));
+}
+
+using board8  = xstd::bit_grid< 8,  8, std::uint64_t>;
+using board32 = xstd::bit_grid<32, 32, std::uint64_t>;
+using board64 = xstd::bit_grid<64, 64, std::uint64_t>;
+
+BENCHMARK_TEMPLATE(bm_life_step, board8);
+BENCHMARK_TEMPLATE(bm_life_step, board32);
+BENCHMARK_TEMPLATE(bm_life_step, board64);
+
+BENCHMARK_TEMPLATE(bm_life_world, board8,  32, 32);
+BENCHMARK_TEMPLATE(bm_life_world, board32,  8,  8);
+BENCHMARK_TEMPLATE(bm_life_world, board64,  4,  4);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,57 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/atomic_bit_set.hpp>      // atomic_bit_set
+#include <xstd/bit_set.hpp>             // bit_set
+#include <benchmark/benchmark.h>        // DoNotOptimize, BENCHMARK_TEMPLATE, BENCHMARK_MAIN
+#include <cstddef>                      // size_t
+#include <cstdint>                      // int64_t
+#include <mutex>                        // lock_guard, mutex
+#include <random>                       // mt19937_64
+
+// A visited set of N elements shared by 1 to 8 threads, each of which
+// inserts and erases random elements: a bit_set guarded by a std::mutex
+// against an atomic_bit_set. Every benchmark reports the insertions and
+// erasures per second of each thread as items per second.
+
+namespace {
+
+template<std::size_t N>
+class locked_bit_set
+{
+        std::mutex m_mutex;
+        xstd::bit_set<N> m_set;
+
+public:
+        bool insert(std::size_t x)
+        {
+                auto const lock = std::lock_guard(m_mutex);
+                return m_set.insert(x).second;
+        }
+
+        std::size_t erase(std::size_t x)
+        {
+                auto const lock = std::lock_guard(m_mutex);
+                return m_set.erase(x);
+        }
+};
+
+}       // namespace
+
+template<std::size_t N, class Set>
+static void bm_insert_erase(benchmark::State& state) {
+        static auto set = Set();
+        auto urbg = std::mt19937_64(static_cast<std::uint64_t>(state.thread_index()));
+        for (auto _ : state) {
+                benchmark::DoNotOptimize(set.insert(urbg() % N));
+                benchmark::DoNotOptimize(set.erase(urbg() % N));
+        }
+        state.SetItemsProcessed(state.iterations() * 2);
+}
+
+BENCHMARK_TEMPLATE(bm_insert_erase, 4096, locked_bit_set<4096>)->ThreadRange(1, 8);
+BENCHMARK_TEMPLATE(bm_insert_erase, 4096, xstd::atomic_bit_set<4096>)->ThreadRange(1, 8);
+
+BENCHMARK_MAIN();
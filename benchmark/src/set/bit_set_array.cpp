@@ -0,0 +1,120 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit_set_array.hpp>       // bit_set_array
+#include <xstd/bit_set.hpp>             // bit_set
+#include <benchmark/benchmark.h>        // ClobberMemory, DoNotOptimize, BENCHMARK, BENCHMARK_MAIN
+#include <cstddef>                      // size_t
+#include <cstdint>                      // int64_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+#include <vector>                       // vector
+
+// Bulk operations over 2^20 sets of 256 bits, stored as a vector of
+// bit_sets (one set after another) or as a bit_set_array (tiled, with the
+// sets of a tile side by side). Every benchmark reports sets per second as
+// items per second.
+
+namespace {
+
+constexpr auto num_bits = 256uz;
+constexpr auto num_sets = 1uz << 20;
+
+using set_type = xstd::bit_set<num_bits>;
+
+auto random_set(auto& urbg, std::size_t density)
+{
+        auto s = set_type();
+        for (auto i : std::views::iota(0uz, num_bits)) {
+                if (urbg() % 64 < density) {
+                        s.insert(i);
+                }
+        }
+        return s;
+}
+
+auto make_sets()
+{
+        auto urbg = std::mt19937_64();
+        auto sets = std::vector<set_type>();
+        for ([[maybe_unused]] auto _ : std::views::iota(0uz, num_sets)) {
+                sets.push_back(random_set(urbg, 1));
+        }
+        return sets;
+}
+
+auto const sets = make_sets();
+auto const mask = []() { auto urbg = std::mt19937_64(1); return random_set(urbg, 48); }();
+
+}       // namespace
+
+static void bm_vector_and(benchmark::State& state) {
+        auto v = sets;
+        for (auto _ : state) {
+                for (auto& s : v) {
+                        s &= mask;
+                }
+                benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_sets));
+}
+
+static void bm_array_and(benchmark::State& state) {
+        auto a = xstd::bit_set_array<num_bits>(sets);
+        for (auto _ : state) {
+                a &= mask;
+                benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_sets));
+}
+
+static void bm_vector_counts(benchmark::State& state) {
+        auto counts = std::vector<std::size_t>(num_sets);
+        for (auto _ : state) {
+                for (auto i : std::views::iota(0uz, num_sets)) {
+                        counts[i] = sets[i].size();
+                }
+                benchmark::DoNotOptimize(counts.data());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_sets));
+}
+
+static void bm_array_counts(benchmark::State& state) {
+        auto const a = xstd::bit_set_array<num_bits>(sets);
+        for (auto _ : state) {
+                benchmark::DoNotOptimize(a.counts());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_sets));
+}
+
+static void bm_vector_subsets_of(benchmark::State& state) {
+        for (auto _ : state) {
+                auto ids = std::vector<std::size_t>();
+                for (auto i : std::views::iota(0uz, num_sets)) {
+                        if (sets[i].is_subset_of(mask)) {
+                                ids.push_back(i);
+                        }
+                }
+                benchmark::DoNotOptimize(ids);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_sets));
+}
+
+static void bm_array_subsets_of(benchmark::State& state) {
+        auto const a = xstd::bit_set_array<num_bits>(sets);
+        for (auto _ : state) {
+                benchmark::DoNotOptimize(a.subsets_of(mask));
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_sets));
+}
+
+BENCHMARK(bm_vector_and);
+BENCHMARK(bm_array_and);
+BENCHMARK(bm_vector_counts);
+BENCHMARK(bm_array_counts);
+BENCHMARK(bm_vector_subsets_of);
+BENCHMARK(bm_array_subsets_of);
+
+BENCHMARK_MAIN();
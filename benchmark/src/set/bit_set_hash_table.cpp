@@ -0,0 +1,87 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit_set_hash_table.hpp>  // bit_set_hash_set
+#include <xstd/bit_set.hpp>             // bit_set
+#include <benchmark/benchmark.h>        // DoNotOptimize, BENCHMARK_TEMPLATE, BENCHMARK_MAIN
+#include <cstddef>                      // size_t
+#include <cstdint>                      // int64_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+#include <unordered_set>                // unordered_set
+#include <vector>                       // vector
+
+// The visited set of a state-space search: inserting num_keys random
+// bit_set<N> keys with 1 in 4 elements present into an empty hash set
+// (bm_insert), and looking up as many keys, half of which are present, in
+// the filled hash set (bm_lookup). The hash set is either std::unordered_set
+// with std::hash<bit_set>, or bit_set_hash_set with the same hash. Both
+// report keys per second as items per second.
+
+namespace {
+
+constexpr auto num_keys = 1uz << 16;
+
+template<std::size_t N>
+auto random_keys(std::size_t n, std::uint64_t seed)
+{
+        auto urbg = std::mt19937_64(seed);
+        auto nrv = std::vector<xstd::bit_set<N>>(n);
+        for (auto& s : nrv) {
+                for (auto i : std::views::iota(0uz, N)) {
+                        if (urbg() % 4 == 0) {
+                                s.insert(i);
+                        }
+                }
+        }
+        return nrv;
+}
+
+}       // namespace
+
+template<std::size_t N, class Set>
+static void bm_insert(benchmark::State& state) {
+        auto const keys = random_keys<N>(num_keys, 1);
+        for (auto _ : state) {
+                auto set = Set();
+                for (auto const& k : keys) {
+                        set.insert(k);
+                }
+                benchmark::DoNotOptimize(set.size());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_keys));
+}
+
+template<std::size_t N, class Set>
+static void bm_lookup(benchmark::State& state) {
+        auto const keys = random_keys<N>(num_keys, 1);
+        auto queries = random_keys<N>(num_keys, 2);
+        for (auto i = 0uz; i < num_keys; i += 2) {
+                queries[i] = keys[i];
+        }
+        auto set = Set();
+        for (auto const& k : keys) {
+                set.insert(k);
+        }
+        for (auto _ : state) {
+                auto found = 0uz;
+                for (auto const& q : queries) {
+                        found += set.contains(q);
+                }
+                benchmark::DoNotOptimize(found);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_keys));
+}
+
+BENCHMARK_TEMPLATE(bm_insert,  64, std::unordered_set<xstd::bit_set< 64>>);
+BENCHMARK_TEMPLATE(bm_insert,  64, xstd::bit_set_hash_set< 64>);
+BENCHMARK_TEMPLATE(bm_insert, 512, std::unordered_set<xstd::bit_set<512>>);
+BENCHMARK_TEMPLATE(bm_insert, 512, xstd::bit_set_hash_set<512>);
+BENCHMARK_TEMPLATE(bm_lookup,  64, std::unordered_set<xstd::bit_set< 64>>);
+BENCHMARK_TEMPLATE(bm_lookup,  64, xstd::bit_set_hash_set< 64>);
+BENCHMARK_TEMPLATE(bm_lookup, 512, std::unordered_set<xstd::bit_set<512>>);
+BENCHMARK_TEMPLATE(bm_lookup, 512, xstd::bit_set_hash_set<512>);
+
+BENCHMARK_MAIN();
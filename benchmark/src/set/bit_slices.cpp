@@ -0,0 +1,107 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit_slices.hpp>          // bit_slices
+#include <xstd/bit_set.hpp>             // bit_set
+#include <benchmark/benchmark.h>        // DoNotOptimize, BENCHMARK, BENCHMARK_MAIN
+#include <cstddef>                      // size_t
+#include <cstdint>                      // int64_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+#include <span>                         // span
+#include <vector>                       // vector
+
+// Which of Count sets of 256 bits contain all of three elements {i, j, k}:
+// a horizontal scan testing every set, against the AND of three slices of
+// the bit-sliced layout. Every benchmark reports queries per second as
+// items per second.
+
+namespace {
+
+constexpr auto num_bits = 256uz;
+constexpr auto num_queries = 1024uz;
+
+using set_type = xstd::bit_set<num_bits>;
+
+template<std::size_t Count>
+auto make_sets()
+{
+        auto urbg = std::mt19937_64();
+        auto sets = std::vector<set_type>();
+        for ([[maybe_unused]] auto _ : std::views::iota(0uz, Count)) {
+                auto s = set_type();
+                for (auto i : std::views::iota(0uz, num_bits)) {
+                        if (urbg() % 2 == 0) {
+                                s.insert(i);
+                        }
+                }
+                sets.push_back(s);
+        }
+        return sets;
+}
+
+struct query
+{
+        std::size_t i, j, k;
+};
+
+auto const queries = []() {
+        auto urbg = std::mt19937_64(1);
+        auto nrv = std::vector<query>();
+        for ([[maybe_unused]] auto _ : std::views::iota(0uz, num_queries)) {
+                nrv.push_back({ urbg() % num_bits, urbg() % num_bits, urbg() % num_bits });
+        }
+        return nrv;
+}();
+
+}       // namespace
+
+template<std::size_t Count>
+static void bm_scan(benchmark::State& state) {
+        auto const sets = make_sets<Count>();
+        for (auto _ : state) {
+                for (auto [i, j, k] : queries) {
+                        auto result = xstd::bit_set<Count>();
+                        for (auto s : std::views::iota(0uz, Count)) {
+                                if (sets[s].contains(i) and sets[s].contains(j) and sets[s].contains(k)) {
+                                        result.insert(s);
+                                }
+                        }
+                        benchmark::DoNotOptimize(result);
+                }
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_queries));
+}
+
+template<std::size_t Count>
+static void bm_slices(benchmark::State& state) {
+        auto const sets = make_sets<Count>();
+        auto const slices = xstd::bit_slices<num_bits, Count>(std::span<set_type const>(sets));
+        for (auto _ : state) {
+                for (auto [i, j, k] : queries) {
+                        auto result = slices.containing_all({ i, j, k });
+                        benchmark::DoNotOptimize(result);
+                }
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_queries));
+}
+
+template<std::size_t Count>
+static void bm_transpose(benchmark::State& state) {
+        auto const sets = make_sets<Count>();
+        for (auto _ : state) {
+                auto slices = xstd::bit_slices<num_bits, Count>(std::span<set_type const>(sets));
+                benchmark::DoNotOptimize(slices);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(Count));
+}
+
+BENCHMARK_TEMPLATE(bm_scan,       64);
+BENCHMARK_TEMPLATE(bm_slices,     64);
+BENCHMARK_TEMPLATE(bm_scan,      512);
+BENCHMARK_TEMPLATE(bm_slices,    512);
+BENCHMARK_TEMPLATE(bm_transpose, 512);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,75 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <opt/set/bitmap_index.hpp>     // bitmap_encoding, bitmap_index
+#include <xstd/bit_set.hpp>             // bit_set
+#include <benchmark/benchmark.h>        // DoNotOptimize, BENCHMARK, BENCHMARK_TEMPLATE, BENCHMARK_MAIN
+#include <cstddef>                      // size_t
+#include <cstdint>                      // int64_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+#include <vector>                       // vector
+
+// A column of 2^16 rows with 64 distinct values, queried for
+//
+//      (10 <= value <= 40 and value not in {12, 13, 14}) or value = 50
+//
+// Every benchmark reports rows per second as items per second.
+
+namespace {
+
+constexpr auto num_rows = 1uz << 16;
+
+using set_type = xstd::bit_set<num_rows>;
+
+auto make_column()
+{
+        auto urbg = std::mt19937_64();
+        auto column = std::vector<int>(num_rows);
+        for (auto& x : column) {
+                x = static_cast<int>(urbg() % 64);
+        }
+        return column;
+}
+
+}       // namespace
+
+template<xstd::bitmap_encoding Encoding>
+static void bm_fused_count(benchmark::State& state) {
+        auto const index = xstd::bitmap_index<int, num_rows>(make_column(), Encoding);
+        for (auto _ : state) {
+                auto const q = (index.between(10, 40) & ~index.in({ 12, 13, 14 })) | index.equal(50);
+                benchmark::DoNotOptimize(index.count(q));
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_rows));
+}
+
+// The same query with one set-algebra kernel per operator, materializing
+// every intermediate bit_set.
+static void bm_materialized_count(benchmark::State& state) {
+        auto const column = make_column();
+        auto bitmaps = std::vector<set_type>(64);
+        auto rows = set_type();
+        for (auto r : std::views::iota(0uz, num_rows)) {
+                bitmaps[static_cast<std::size_t>(column[r])].insert(r);
+                rows.insert(r);
+        }
+        for (auto _ : state) {
+                auto range = set_type();
+                for (auto v : std::views::iota(10uz, 41uz)) {
+                        range |= bitmaps[v];
+                }
+                auto const excluded = bitmaps[12] | bitmaps[13] | bitmaps[14];
+                auto const result = (range & (rows - excluded)) | bitmaps[50];
+                benchmark::DoNotOptimize(result.size());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_rows));
+}
+
+BENCHMARK_TEMPLATE(bm_fused_count, xstd::bitmap_encoding::equality);
+BENCHMARK_TEMPLATE(bm_fused_count, xstd::bitmap_encoding::range);
+BENCHMARK(bm_materialized_count);
+
+BENCHMARK_MAIN();
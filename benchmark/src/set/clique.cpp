@@ -0,0 +1,44 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <opt/set/clique.hpp>           // dsatur_coloring, make_random_graph, max_clique
+#include <xstd/bit_set.hpp>             // bit_set
+#include <benchmark/benchmark.h>        // DoNotOptimize, BENCHMARK_TEMPLATE, BENCHMARK_MAIN
+#include <cstddef>                      // size_t
+#include <random>                       // mt19937
+
+// DIMACS-style G(n, p) instances, named after the C<n>.<p> / p_hat families
+// whose vertex counts and densities they mimic: every run searches the same
+// graph, generated from a fixed seed.
+template<class X, std::size_t N, int Percent>
+static void bm_max_clique(benchmark::State& state) {
+        auto urbg = std::mt19937(N + Percent);
+        auto const adj = xstd::make_random_graph<X>(N, Percent / 100.0, urbg);
+        for (auto _ : state) {
+                benchmark::DoNotOptimize(xstd::max_clique(adj));
+        }
+}
+
+template<class X, std::size_t N, int Percent>
+static void bm_dsatur_coloring(benchmark::State& state) {
+        auto urbg = std::mt19937(N + Percent);
+        auto const adj = xstd::make_random_graph<X>(N, Percent / 100.0, urbg);
+        for (auto _ : state) {
+                benchmark::DoNotOptimize(xstd::dsatur_coloring(adj));
+        }
+}
+
+BENCHMARK_TEMPLATE(bm_max_clique, xstd::bit_set< 64>,  64, 50);
+BENCHMARK_TEMPLATE(bm_max_clique, xstd::bit_set<125>, 125, 50);
+BENCHMARK_TEMPLATE(bm_max_clique, xstd::bit_set<125>, 125, 75);
+BENCHMARK_TEMPLATE(bm_max_clique, xstd::bit_set<200>, 200, 50);
+BENCHMARK_TEMPLATE(bm_max_clique, xstd::bit_set<250>, 250, 50);
+BENCHMARK_TEMPLATE(bm_max_clique, xstd::bit_set<500>, 500, 25);
+
+BENCHMARK_TEMPLATE(bm_dsatur_coloring, xstd::bit_set<125>, 125, 50);
+BENCHMARK_TEMPLATE(bm_dsatur_coloring, xstd::bit_set<250>, 250, 50);
+BENCHMARK_TEMPLATE(bm_dsatur_coloring, xstd::bit_set<500>, 500, 50);
+
+BENCHMARK_MAIN();
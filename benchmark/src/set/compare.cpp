@@ -0,0 +1,116 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit_set.hpp>             // bit_set
+#include <benchmark/benchmark.h>        // DoNotOptimize, BENCHMARK_TEMPLATE, BENCHMARK_MAIN
+#include <algorithm>                    // lexicographical_compare_three_way
+#include <cstddef>                      // size_t
+#include <cstdint>                      // int64_t
+#include <functional>                   // less
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+#include <set>                          // set
+#include <utility>                      // pair
+#include <vector>                       // vector
+
+// bit_set's <=> (one pass over the blocks up to the first differing one)
+// against std::lexicographical_compare_three_way over its iterators (one
+// step per element up to the first differing one), on pairs of sets with a
+// quarter of their elements present that differ in a single element, and
+// as the ordering of a std::set of bit_sets. Every benchmark reports
+// comparisons (or insertions) per second as items per second.
+
+namespace {
+
+constexpr auto num_pairs = 4096uz;
+constexpr auto num_inserts = 1uz << 14;
+
+template<std::size_t N>
+auto random_set(auto& urbg)
+{
+        auto s = xstd::bit_set<N>();
+        for (auto i : std::views::iota(0uz, N)) {
+                if (urbg() % 4 == 0) {
+                        s.insert(i);
+                }
+        }
+        return s;
+}
+
+template<std::size_t N>
+auto make_pairs()
+{
+        auto urbg = std::mt19937_64();
+        auto pairs = std::vector<std::pair<xstd::bit_set<N>, xstd::bit_set<N>>>();
+        for ([[maybe_unused]] auto _ : std::views::iota(0uz, num_pairs)) {
+                auto const x = random_set<N>(urbg);
+                auto y = x;
+                y.complement(urbg() % N);
+                pairs.emplace_back(x, y);
+        }
+        return pairs;
+}
+
+struct iterator_less
+{
+        template<class X>
+        bool operator()(X const& x, X const& y) const noexcept
+        {
+                return std::lexicographical_compare_three_way(x.begin(), x.end(), y.begin(), y.end()) < 0;
+        }
+};
+
+}       // namespace
+
+template<std::size_t N>
+static void bm_iterators(benchmark::State& state) {
+        auto const pairs = make_pairs<N>();
+        for (auto _ : state) {
+                for (auto const& [x, y] : pairs) {
+                        benchmark::DoNotOptimize(iterator_less()(x, y));
+                }
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_pairs));
+}
+
+template<std::size_t N>
+static void bm_blocks(benchmark::State& state) {
+        auto const pairs = make_pairs<N>();
+        for (auto _ : state) {
+                for (auto const& [x, y] : pairs) {
+                        benchmark::DoNotOptimize(x < y);
+                }
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_pairs));
+}
+
+template<std::size_t N, class Compare>
+static void bm_std_set(benchmark::State& state) {
+        auto urbg = std::mt19937_64();
+        auto sets = std::vector<xstd::bit_set<N>>();
+        for ([[maybe_unused]] auto _ : std::views::iota(0uz, num_inserts)) {
+                sets.push_back(random_set<N>(urbg));
+        }
+        for (auto _ : state) {
+                auto s = std::set<xstd::bit_set<N>, Compare>();
+                for (auto const& x : sets) {
+                        s.insert(x);
+                }
+                benchmark::DoNotOptimize(s.size());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_inserts));
+}
+
+BENCHMARK_TEMPLATE(bm_iterators,   64);
+BENCHMARK_TEMPLATE(bm_blocks,      64);
+BENCHMARK_TEMPLATE(bm_iterators,  256);
+BENCHMARK_TEMPLATE(bm_blocks,     256);
+BENCHMARK_TEMPLATE(bm_iterators, 1024);
+BENCHMARK_TEMPLATE(bm_blocks,    1024);
+
+BENCHMARK_TEMPLATE(bm_std_set, 256, iterator_less);
+BENCHMARK_TEMPLATE(bm_std_set, 256, std::less<>);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,104 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <opt/set/containment_index.hpp>        // containment_index
+#include <xstd/bit_set.hpp>                     // bit_set
+#include <benchmark/benchmark.h>                // DoNotOptimize, BENCHMARK, BENCHMARK_MAIN
+#include <cmath>                                // pow
+#include <cstddef>                              // size_t
+#include <cstdint>                              // int64_t
+#include <random>                               // discrete_distribution, mt19937_64
+#include <ranges>                               // iota
+#include <vector>                               // vector
+
+// Containment queries over 2^20 rule antecedents of 2 to 9 elements out of
+// 256, with Zipf-distributed element frequencies. Superset queries have 2
+// elements, subset queries have 48. Every benchmark reports stored sets per
+// second as items per second.
+
+namespace {
+
+constexpr auto num_elements = 256uz;
+constexpr auto num_sets = 1uz << 20;
+
+using set_type = xstd::bit_set<num_elements>;
+
+auto make_sets(std::size_t n, std::size_t min_size, std::size_t max_size, std::uint64_t seed)
+{
+        auto urbg = std::mt19937_64(seed);
+        auto weights = std::vector<double>();
+        for (auto e : std::views::iota(0uz, num_elements)) {
+                weights.push_back(1.0 / std::pow(static_cast<double>(e + 1), 0.8));
+        }
+        auto zipf = std::discrete_distribution<std::size_t>(weights.begin(), weights.end());
+        auto sets = std::vector<set_type>(n);
+        for (auto& s : sets) {
+                for (auto size = min_size + urbg() % (max_size - min_size + 1); s.size() < size; ) {
+                        s.insert(zipf(urbg));
+                }
+        }
+        return sets;
+}
+
+auto const sets = make_sets(num_sets, 2, 9, 0);
+auto const supersets_of = make_sets(64, 2, 2, 1);
+auto const subsets_of = make_sets(64, 48, 48, 2);
+
+}       // namespace
+
+static void bm_scan_supersets(benchmark::State& state) {
+        auto q = 0uz;
+        for (auto _ : state) {
+                auto const& query = supersets_of[q++ % supersets_of.size()];
+                auto ids = std::vector<std::size_t>();
+                for (auto id : std::views::iota(0uz, num_sets)) {
+                        if (query.is_subset_of(sets[id])) {
+                                ids.push_back(id);
+                        }
+                }
+                benchmark::DoNotOptimize(ids);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_sets));
+}
+
+static void bm_index_supersets(benchmark::State& state) {
+        auto const index = xstd::containment_index<num_elements>(sets);
+        auto q = 0uz;
+        for (auto _ : state) {
+                benchmark::DoNotOptimize(index.supersets(supersets_of[q++ % supersets_of.size()]));
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_sets));
+}
+
+static void bm_scan_subsets(benchmark::State& state) {
+        auto q = 0uz;
+        for (auto _ : state) {
+                auto const& query = subsets_of[q++ % subsets_of.size()];
+                auto ids = std::vector<std::size_t>();
+                for (auto id : std::views::iota(0uz, num_sets)) {
+                        if (sets[id].is_subset_of(query)) {
+                                ids.push_back(id);
+                        }
+                }
+                benchmark::DoNotOptimize(ids);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_sets));
+}
+
+static void bm_index_subsets(benchmark::State& state) {
+        auto const index = xstd::containment_index<num_elements>(sets);
+        auto q = 0uz;
+        for (auto _ : state) {
+                benchmark::DoNotOptimize(index.subsets(subsets_of[q++ % subsets_of.size()]));
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_sets));
+}
+
+BENCHMARK(bm_scan_supersets);
+BENCHMARK(bm_index_supersets);
+BENCHMARK(bm_scan_subsets);
+BENCHMARK(bm_index_subsets);
+
+BENCHMARK_MAIN();
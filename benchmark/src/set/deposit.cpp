@@ -0,0 +1,73 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit_set.hpp>             // bit_set, deposit, extract
+#include <benchmark/benchmark.h>        // DoNotOptimize, BENCHMARK_TEMPLATE1, BENCHMARK_MAIN
+#include <cstddef>                      // size_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+
+template<class X>
+static auto random_set(auto& urbg)
+{
+        X x;
+        for (auto i : std::views::iota(0uz, X::max_size())) {
+                if (urbg() % 2) {
+                        x.insert(i);
+                }
+        }
+        return x;
+}
+
+// The per-bit loop that deposit/extract replace.
+template<class X>
+static auto loop_extract(X const& src, X const& mask)
+{
+        X nrv;
+        auto i = 0uz;
+        for (std::size_t x : mask) {
+                if (src.contains(x)) {
+                        nrv.insert(i);
+                }
+                ++i;
+        }
+        return nrv;
+}
+
+template<class X>
+static void bm_loop_extract(benchmark::State& state) {
+        auto urbg = std::mt19937_64();
+        auto const src = random_set<X>(urbg), mask = random_set<X>(urbg);
+        for (auto _ : state) {
+                benchmark::DoNotOptimize(loop_extract(src, mask));
+        }
+}
+
+template<class X>
+static void bm_extract(benchmark::State& state) {
+        auto urbg = std::mt19937_64();
+        auto const src = random_set<X>(urbg), mask = random_set<X>(urbg);
+        for (auto _ : state) {
+                benchmark::DoNotOptimize(extract(src, mask));
+        }
+}
+
+template<class X>
+static void bm_deposit(benchmark::State& state) {
+        auto urbg = std::mt19937_64();
+        auto const src = random_set<X>(urbg), mask = random_set<X>(urbg);
+        for (auto _ : state) {
+                benchmark::DoNotOptimize(deposit(src, mask));
+        }
+}
+
+BENCHMARK_TEMPLATE1(bm_loop_extract, xstd::bit_set< 64>);
+BENCHMARK_TEMPLATE1(bm_loop_extract, xstd::bit_set<256>);
+BENCHMARK_TEMPLATE1(bm_extract,      xstd::bit_set< 64>);
+BENCHMARK_TEMPLATE1(bm_extract,      xstd::bit_set<256>);
+BENCHMARK_TEMPLATE1(bm_deposit,      xstd::bit_set< 64>);
+BENCHMARK_TEMPLATE1(bm_deposit,      xstd::bit_set<256>);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,103 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <opt/set/glushkov.hpp>         // glushkov_matcher
+#include <benchmark/benchmark.h>        // DoNotOptimize, BENCHMARK, BENCHMARK_TEMPLATE, BENCHMARK_MAIN
+#include <array>                        // array
+#include <cstddef>                      // size_t
+#include <cstdint>                      // int64_t
+#include <random>                       // mt19937_64
+#include <regex>                        // regex, regex_search
+#include <string>                       // string
+#include <string_view>                  // string_view
+#include <utility>                      // pair
+#include <vector>                       // vector
+
+// Both benchmarks count the log lines matching any of the same alternation-heavy
+// rules in the same 16 KiB of log lines, and report characters per second as
+// bytes per second. std::regex is a backtracking matcher.
+
+namespace {
+
+constexpr auto rules = std::array<std::string_view, 8>
+{
+        "(ERROR|FATAL|CRIT|ALERT|EMERG): .*(timeout|refused|reset|unreachable)",
+        "user=\\w+ (login|logout|sudo|su) (failed|denied)",
+        "(GET|POST|PUT|DELETE|PATCH) /(admin|debug|internal)/",
+        "status=(500|502|503|504)",
+        "(segfault|panic|OOM|oom-killer|core dumped)",
+        "latency=[0-9][0-9][0-9][0-9]+ms",
+        "(disk|memory|cpu|inode) (usage|pressure) (high|critical)",
+        "cert(ificate)? (expired|revoked|invalid)"
+};
+
+auto log_lines()
+{
+        constexpr auto words = std::array<std::string_view, 16>
+        {
+                "INFO", "ERROR:", "GET", "/api/", "status=200", "latency=12ms", "user=bob", "login",
+                "served", "disk", "usage", "normal", "timeout", "cache", "hit", "request"
+        };
+        auto urbg = std::mt19937_64();
+        auto lines = std::vector<std::string>();
+        auto size = 0uz;
+        while (size < (1uz << 14)) {
+                auto line = std::string();
+                for (auto n = 4 + urbg() % 8; n > 0; --n) {
+                        line += words[urbg() % words.size()];
+                        line += ' ';
+                }
+                line.back() = '\n';
+                size += line.size();
+                lines.push_back(line);
+        }
+        return std::pair{ lines, size };
+}
+
+}       // namespace
+
+static void bm_regex_search(benchmark::State& state) {
+        auto const [ lines, size ] = log_lines();
+        auto regexes = std::vector<std::regex>();
+        for (auto r : rules) {
+                regexes.emplace_back(r.begin(), r.end());
+        }
+        for (auto _ : state) {
+                auto count = 0uz;
+                for (auto const& line : lines) {
+                        for (auto const& re : regexes) {
+                                if (std::regex_search(line, re)) {
+                                        ++count;
+                                        break;
+                                }
+                        }
+                }
+                benchmark::DoNotOptimize(count);
+        }
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(size));
+}
+
+template<std::size_t N>
+static void bm_glushkov(benchmark::State& state) {
+        auto const [ lines, size ] = log_lines();
+        auto matcher = xstd::glushkov_matcher<N>(rules);
+        for (auto _ : state) {
+                auto count = 0uz;
+                for (auto const& line : lines) {
+                        auto matched = false;
+                        matcher.reset();
+                        matcher.feed(line, [&](auto, auto) { matched = true; });
+                        count += matched;
+                }
+                benchmark::DoNotOptimize(count);
+        }
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(size));
+}
+
+BENCHMARK(bm_regex_search);
+BENCHMARK_TEMPLATE(bm_glushkov, 320);
+BENCHMARK_TEMPLATE(bm_glushkov, 512);
+
+BENCHMARK_MAIN();
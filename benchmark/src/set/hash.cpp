@@ -0,0 +1,113 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit_set.hpp>             // bit_set
+#include <benchmark/benchmark.h>        // DoNotOptimize, BENCHMARK_TEMPLATE, BENCHMARK_MAIN
+#include <boost/hash2/fnv1a.hpp>        // fnv1a_64
+#include <boost/hash2/hash_append.hpp>  // get_integral_result, hash_append
+#include <algorithm>                    // max, sort, unique
+#include <cstddef>                      // size_t
+#include <cstdint>                      // int64_t
+#include <functional>                   // hash
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+#include <unordered_map>                // unordered_map
+#include <vector>                       // vector
+
+// std::hash<bit_set> (a 64-bit word at a time) against Boost.Hash2's FNV-1a
+// over hash_append (a byte at a time), on sparse sets with 1 in 16 elements
+// present: hashing alone, and an unordered_map<bit_set<N>, std::size_t> that
+// is filled with the sets and then probed for all of them. Every benchmark
+// reports hashes (or insertions plus lookups) per second as items per
+// second. The map benchmarks also count the distinct sets with a duplicate
+// hash value ("collisions") and the largest bucket ("max_bucket").
+
+namespace {
+
+constexpr auto num_sets = 1uz << 16;
+
+struct fnv1a_hash
+{
+        template<class X>
+        std::size_t operator()(X const& x) const noexcept
+        {
+                boost::hash2::fnv1a_64 h;
+                boost::hash2::hash_append(h, {}, x);
+                return boost::hash2::get_integral_result<std::size_t>(h);
+        }
+};
+
+template<std::size_t N>
+auto random_sets()
+{
+        auto urbg = std::mt19937_64();
+        auto sets = std::vector<xstd::bit_set<N>>();
+        for ([[maybe_unused]] auto _ : std::views::iota(0uz, num_sets)) {
+                auto s = xstd::bit_set<N>();
+                for (auto i : std::views::iota(0uz, N)) {
+                        if (urbg() % 16 == 0) {
+                                s.insert(i);
+                        }
+                }
+                sets.push_back(s);
+        }
+        return sets;
+}
+
+}       // namespace
+
+template<std::size_t N, class Hash>
+static void bm_hash(benchmark::State& state) {
+        auto const sets = random_sets<N>();
+        for (auto _ : state) {
+                for (auto const& s : sets) {
+                        benchmark::DoNotOptimize(Hash()(s));
+                }
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_sets));
+}
+
+template<std::size_t N, class Hash>
+static void bm_unordered_map(benchmark::State& state) {
+        auto const sets = random_sets<N>();
+        auto map = std::unordered_map<xstd::bit_set<N>, std::size_t, Hash>();
+        for (auto _ : state) {
+                map.clear();
+                for (auto i : std::views::iota(0uz, sets.size())) {
+                        map.emplace(sets[i], i);
+                }
+                auto found = 0uz;
+                for (auto const& s : sets) {
+                        found += map.count(s);
+                }
+                benchmark::DoNotOptimize(found);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(2 * num_sets));
+
+        auto hashes = std::vector<std::size_t>();
+        for (auto const& entry : map) {
+                hashes.push_back(Hash()(entry.first));
+        }
+        std::ranges::sort(hashes);
+        auto const distinct = static_cast<std::size_t>(std::ranges::unique(hashes).begin() - hashes.begin());
+        auto max_bucket = 0uz;
+        for (auto b : std::views::iota(0uz, map.bucket_count())) {
+                max_bucket = std::max(max_bucket, map.bucket_size(b));
+        }
+        state.counters["collisions"] = static_cast<double>(map.size() - distinct);
+        state.counters["max_bucket"] = static_cast<double>(max_bucket);
+}
+
+BENCHMARK_TEMPLATE(bm_hash,  64, fnv1a_hash);
+BENCHMARK_TEMPLATE(bm_hash,  64, std::hash<xstd::bit_set< 64>>);
+BENCHMARK_TEMPLATE(bm_hash, 256, fnv1a_hash);
+BENCHMARK_TEMPLATE(bm_hash, 256, std::hash<xstd::bit_set<256>>);
+BENCHMARK_TEMPLATE(bm_hash, 512, fnv1a_hash);
+BENCHMARK_TEMPLATE(bm_hash, 512, std::hash<xstd::bit_set<512>>);
+
+BENCHMARK_TEMPLATE(bm_unordered_map, 512, fnv1a_hash);
+BENCHMARK_TEMPLATE(bm_unordered_map, 512, std::hash<xstd::bit_set<512>>);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,94 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <opt/set/minhash.hpp>          // lsh_index, minhash, pack
+#include <xstd/bit_set.hpp>             // bit_set
+#include <benchmark/benchmark.h>        // DoNotOptimize, BENCHMARK, BENCHMARK_MAIN
+#include <cstddef>                      // size_t
+#include <cstdint>                      // int64_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+#include <vector>                       // vector
+
+// A similarity self-join at Jaccard similarity 0.8 over 4096 documents of
+// 1024 bits with 10% density, of which one in eight is a near-duplicate of
+// an earlier one. Every join benchmark reports documents per second as
+// items per second.
+
+namespace {
+
+constexpr auto num_bits = 1024uz;
+constexpr auto num_sets = 4096uz;
+constexpr auto threshold = 0.8;
+
+using set_type = xstd::bit_set<num_bits>;
+
+auto make_documents()
+{
+        auto urbg = std::mt19937_64();
+        auto sets = std::vector<set_type>();
+        for ([[maybe_unused]] auto _ : std::views::iota(0uz, num_sets)) {
+                if (not sets.empty() and urbg() % 8 == 0) {
+                        auto s = sets[urbg() % sets.size()];
+                        for ([[maybe_unused]] auto flip : std::views::iota(0, 8)) {
+                                s.complement(urbg() % num_bits);
+                        }
+                        sets.push_back(s);
+                        continue;
+                }
+                auto s = set_type();
+                for (auto i : std::views::iota(0uz, num_bits)) {
+                        if (urbg() % 10 == 0) {
+                                s.insert(i);
+                        }
+                }
+                sets.push_back(s);
+        }
+        return sets;
+}
+
+}       // namespace
+
+static void bm_all_pairs(benchmark::State& state) {
+        auto const sets = make_documents();
+        for (auto _ : state) {
+                auto n = 0uz;
+                for (auto i : std::views::iota(0uz, num_sets)) {
+                        for (auto j : std::views::iota(i + 1, num_sets)) {
+                                auto const c = (sets[i] & sets[j]).size();
+                                auto const u = (sets[i] | sets[j]).size();
+                                n += static_cast<double>(c) >= threshold * static_cast<double>(u);
+                        }
+                }
+                benchmark::DoNotOptimize(n);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_sets));
+}
+
+// Includes hashing every document into the index.
+static void bm_lsh_join(benchmark::State& state) {
+        auto const sets = make_documents();
+        for (auto _ : state) {
+                auto const index = xstd::lsh_index<num_bits, 20, 5>(sets);
+                benchmark::DoNotOptimize(index.self_join(threshold));
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_sets));
+}
+
+static void bm_signature(benchmark::State& state) {
+        auto const sets = make_documents();
+        auto const h = xstd::minhash<128>();
+        auto i = 0uz;
+        for (auto _ : state) {
+                benchmark::DoNotOptimize(xstd::pack<2>(h(sets[i++ % num_sets])));
+        }
+        state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(bm_all_pairs);
+BENCHMARK(bm_lsh_join);
+BENCHMARK(bm_signature);
+
+BENCHMARK_MAIN();
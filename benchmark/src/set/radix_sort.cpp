@@ -0,0 +1,99 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <opt/set/radix_sort.hpp>       // sort_bit_sets, unique_bit_sets
+#include <xstd/bit_set.hpp>             // bit_set
+#include <benchmark/benchmark.h>        // DoNotOptimize, BENCHMARK, BENCHMARK_MAIN
+#include <algorithm>                    // sort, unique
+#include <cstddef>                      // size_t
+#include <cstdint>                      // int64_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+#include <vector>                       // vector
+
+// Sorting and uniquing 2^20 sets through operator<=> (std::ranges::sort and
+// std::ranges::unique) or by radix sort, for sets of 64 and 256 bits with 8
+// random elements, of which about a quarter are duplicates. Every benchmark
+// reports sets per second as items per second.
+
+namespace {
+
+constexpr auto num_sets = 1uz << 20;
+
+template<std::size_t N>
+auto make_sets()
+{
+        auto urbg = std::mt19937_64();
+        auto sets = std::vector<xstd::bit_set<N>>();
+        for ([[maybe_unused]] auto _ : std::views::iota(0uz, num_sets)) {
+                if (not sets.empty() and urbg() % 4 == 0) {
+                        sets.push_back(sets[urbg() % sets.size()]);
+                        continue;
+                }
+                auto s = xstd::bit_set<N>();
+                for ([[maybe_unused]] auto _ : std::views::iota(0, 8)) {
+                        s.insert(urbg() % N);
+                }
+                sets.push_back(s);
+        }
+        return sets;
+}
+
+}       // namespace
+
+template<std::size_t N>
+static void bm_std_sort(benchmark::State& state) {
+        auto const sets = make_sets<N>();
+        for (auto _ : state) {
+                auto v = sets;
+                std::ranges::sort(v);
+                benchmark::DoNotOptimize(v.data());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_sets));
+}
+
+template<std::size_t N>
+static void bm_radix_sort(benchmark::State& state) {
+        auto const sets = make_sets<N>();
+        for (auto _ : state) {
+                auto v = sets;
+                xstd::sort_bit_sets(v);
+                benchmark::DoNotOptimize(v.data());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_sets));
+}
+
+template<std::size_t N>
+static void bm_std_unique(benchmark::State& state) {
+        auto const sets = make_sets<N>();
+        for (auto _ : state) {
+                auto v = sets;
+                std::ranges::sort(v);
+                auto const [first, last] = std::ranges::unique(v);
+                v.erase(first, last);
+                benchmark::DoNotOptimize(v.data());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_sets));
+}
+
+template<std::size_t N>
+static void bm_radix_unique(benchmark::State& state) {
+        auto const sets = make_sets<N>();
+        for (auto _ : state) {
+                auto v = sets;
+                xstd::unique_bit_sets(v);
+                benchmark::DoNotOptimize(v.data());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_sets));
+}
+
+BENCHMARK_TEMPLATE(bm_std_sort,      64);
+BENCHMARK_TEMPLATE(bm_radix_sort,    64);
+BENCHMARK_TEMPLATE(bm_std_unique,    64);
+BENCHMARK_TEMPLATE(bm_radix_unique,  64);
+BENCHMARK_TEMPLATE(bm_std_sort,     256);
+BENCHMARK_TEMPLATE(bm_radix_sort,   256);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,74 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <opt/set/shift_and.hpp>        // shift_and_matcher
+#include <benchmark/benchmark.h>        // DoNotOptimize, BENCHMARK, BENCHMARK_TEMPLATE, BENCHMARK_MAIN
+#include <array>                        // array
+#include <cstddef>                      // size_t
+#include <cstdint>                      // int64_t
+#include <random>                       // mt19937_64
+#include <string>                       // string
+#include <string_view>                  // string_view
+
+// Both benchmarks count the occurrences of the same patterns in the same
+// 64 KiB of log lines, and report characters per second as bytes per second.
+
+namespace {
+
+constexpr auto patterns = std::array<std::string_view, 8>
+{
+        "ERROR", "FATAL", "timeout", "refused", "denied", "panic", "segfault", "OOM"
+};
+
+auto log_text()
+{
+        constexpr auto words = std::array<std::string_view, 12>
+        {
+                "INFO", "DEBUG", "request", "served", "in", "ms", "user", "login", "cache", "hit", "ERROR", "timeout"
+        };
+        auto urbg = std::mt19937_64();
+        auto text = std::string();
+        while (text.size() < (1uz << 16)) {
+                text += words[urbg() % words.size()];
+                text += urbg() % 8 == 0 ? '\n' : ' ';
+        }
+        return text;
+}
+
+}       // namespace
+
+static void bm_string_view_find(benchmark::State& state) {
+        auto const text = log_text();
+        auto const view = std::string_view(text);
+        for (auto _ : state) {
+                auto count = 0uz;
+                for (auto p : patterns) {
+                        for (auto n = view.find(p); n != std::string_view::npos; n = view.find(p, n + 1)) {
+                                ++count;
+                        }
+                }
+                benchmark::DoNotOptimize(count);
+        }
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text.size()));
+}
+
+template<std::size_t N>
+static void bm_shift_and(benchmark::State& state) {
+        auto const text = log_text();
+        auto matcher = xstd::shift_and_matcher<N>(patterns);
+        for (auto _ : state) {
+                auto count = 0uz;
+                matcher.reset();
+                matcher.feed(text, [&](auto, auto) { ++count; });
+                benchmark::DoNotOptimize(count);
+        }
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text.size()));
+}
+
+BENCHMARK(bm_string_view_find);
+BENCHMARK_TEMPLATE(bm_shift_and,  64);
+BENCHMARK_TEMPLATE(bm_shift_and, 128);
+
+BENCHMARK_MAIN();
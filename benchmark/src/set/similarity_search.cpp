@@ -0,0 +1,105 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <opt/set/similarity_search.hpp>        // similarity, similarity_index
+#include <xstd/bit_set.hpp>                     // bit_set
+#include <benchmark/benchmark.h>                // DoNotOptimize, BENCHMARK, BENCHMARK_TEMPLATE, BENCHMARK_MAIN
+#include <algorithm>                            // partial_sort
+#include <cstddef>                              // size_t
+#include <cstdint>                              // int64_t
+#include <random>                               // mt19937_64
+#include <ranges>                               // iota
+#include <utility>                              // pair
+#include <vector>                               // vector
+
+// Top-10 Tanimoto screening of 2^16 fingerprints of 1024 bits, with bit
+// densities between 2% and 30% as for hashed chemical fingerprints. The
+// library consists of analog series: 1024 random scaffolds with 64 variants
+// each, 16 bits apart. The queries are library members with 16 bits
+// flipped. Every benchmark reports fingerprints per second as items per
+// second.
+
+namespace {
+
+constexpr auto num_bits = 1024uz;
+constexpr auto num_sets = 1uz << 16;
+constexpr auto k        = 10uz;
+
+using set_type = xstd::bit_set<num_bits>;
+
+auto mutate(set_type s, auto& urbg)
+{
+        for ([[maybe_unused]] auto _ : std::views::iota(0, 16)) {
+                s.complement(urbg() % num_bits);
+        }
+        return s;
+}
+
+auto make_library()
+{
+        auto urbg = std::mt19937_64();
+        auto sets = std::vector<set_type>();
+        for ([[maybe_unused]] auto _ : std::views::iota(0uz, num_sets / 64)) {
+                auto const density = 20 + urbg() % 280;
+                auto scaffold = set_type();
+                for (auto i : std::views::iota(0uz, num_bits)) {
+                        if (urbg() % 1000 < density) {
+                                scaffold.insert(i);
+                        }
+                }
+                for ([[maybe_unused]] auto _ : std::views::iota(0, 64)) {
+                        sets.push_back(mutate(scaffold, urbg));
+                }
+        }
+        return sets;
+}
+
+auto make_queries(std::vector<set_type> const& sets)
+{
+        auto urbg = std::mt19937_64(1);
+        auto queries = std::vector<set_type>(64);
+        for (auto& q : queries) {
+                q = mutate(sets[urbg() % sets.size()], urbg);
+        }
+        return queries;
+}
+
+}       // namespace
+
+// Scores every fingerprint with set algebra, then partially sorts.
+static void bm_brute_force(benchmark::State& state) {
+        auto const sets = make_library();
+        auto const queries = make_queries(sets);
+        auto hits = std::vector<std::pair<double, std::size_t>>(num_sets);
+        auto q = 0uz;
+        for (auto _ : state) {
+                auto const& query = queries[q++ % queries.size()];
+                for (auto id : std::views::iota(0uz, num_sets)) {
+                        auto const c = (query & sets[id]).size();
+                        auto const u = (query | sets[id]).size();
+                        hits[id] = { -static_cast<double>(c) / static_cast<double>(u), id };
+                }
+                std::ranges::partial_sort(hits, hits.begin() + k);
+                benchmark::DoNotOptimize(hits.front());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_sets));
+}
+
+static void bm_top_k(benchmark::State& state) {
+        auto const sets = make_library();
+        auto const queries = make_queries(sets);
+        auto const index = xstd::similarity_index<num_bits>(sets);
+        auto const num_threads = static_cast<std::size_t>(state.range(0));
+        auto q = 0uz;
+        for (auto _ : state) {
+                benchmark::DoNotOptimize(index.top_k(queries[q++ % queries.size()], k, xstd::similarity::tanimoto, num_threads));
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_sets));
+}
+
+BENCHMARK(bm_brute_force);
+BENCHMARK(bm_top_k)->Arg(1)->Arg(4)->UseRealTime();
+
+BENCHMARK_MAIN();
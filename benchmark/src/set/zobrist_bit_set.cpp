@@ -0,0 +1,122 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/zobrist_bit_set.hpp>     // zobrist_bit_set
+#include <xstd/bit_set.hpp>             // bit_set
+#include <benchmark/benchmark.h>        // DoNotOptimize, BENCHMARK_TEMPLATE, BENCHMARK_MAIN
+#include <cstddef>                      // size_t
+#include <cstdint>                      // int64_t
+#include <functional>                   // hash
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+#include <utility>                      // pair
+#include <vector>                       // vector
+
+// The hash of a position after every move, a move taking one element of a
+// bit_set<N> with 1 in 4 elements present to an absent one: recomputed
+// after every move with std::hash<bit_set> or from the Zobrist keys, or
+// kept up to date by zobrist_bit_set, either per element (erase and insert)
+// or in bulk (^= with the two changed elements). Every benchmark reports
+// moves per second as items per second.
+
+namespace {
+
+constexpr auto num_moves = 1uz << 12;
+
+template<std::size_t N>
+auto random_game()
+{
+        auto urbg = std::mt19937_64();
+        auto s = xstd::bit_set<N>();
+        for (auto i : std::views::iota(0uz, N)) {
+                if (urbg() % 4 == 0) {
+                        s.insert(i);
+                }
+        }
+        auto const start = s;
+        auto moves = std::vector<std::pair<std::size_t, std::size_t>>();
+        while (moves.size() < num_moves) {
+                auto const from = urbg() % N;
+                auto const to = urbg() % N;
+                if (s.contains(from) and not s.contains(to)) {
+                        s.erase(from);
+                        s.insert(to);
+                        moves.emplace_back(from, to);
+                }
+        }
+        return std::pair{ start, moves };
+}
+
+}       // namespace
+
+template<std::size_t N>
+static void bm_std_hash(benchmark::State& state) {
+        auto const [start, moves] = random_game<N>();
+        for (auto _ : state) {
+                auto s = start;
+                for (auto [from, to] : moves) {
+                        s.erase(from);
+                        s.insert(to);
+                        benchmark::DoNotOptimize(std::hash<xstd::bit_set<N>>()(s));
+                }
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_moves));
+}
+
+template<std::size_t N>
+static void bm_zobrist_rehash(benchmark::State& state) {
+        auto const [start, moves] = random_game<N>();
+        for (auto _ : state) {
+                auto s = start;
+                for (auto [from, to] : moves) {
+                        s.erase(from);
+                        s.insert(to);
+                        benchmark::DoNotOptimize(xstd::zobrist_bit_set<N>(s).hash());
+                }
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_moves));
+}
+
+template<std::size_t N>
+static void bm_zobrist_incremental(benchmark::State& state) {
+        auto const [start, moves] = random_game<N>();
+        for (auto _ : state) {
+                auto z = xstd::zobrist_bit_set<N>(start);
+                for (auto [from, to] : moves) {
+                        z.erase(from);
+                        z.insert(to);
+                        benchmark::DoNotOptimize(z.hash());
+                }
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_moves));
+}
+
+template<std::size_t N>
+static void bm_zobrist_bulk(benchmark::State& state) {
+        auto const [start, moves] = random_game<N>();
+        auto masks = std::vector<xstd::bit_set<N>>();
+        for (auto [from, to] : moves) {
+                masks.push_back(xstd::bit_set<N>{ from, to });
+        }
+        for (auto _ : state) {
+                auto z = xstd::zobrist_bit_set<N>(start);
+                for (auto const& m : masks) {
+                        z ^= m;
+                        benchmark::DoNotOptimize(z.hash());
+                }
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(num_moves));
+}
+
+BENCHMARK_TEMPLATE(bm_std_hash,              64);
+BENCHMARK_TEMPLATE(bm_zobrist_rehash,        64);
+BENCHMARK_TEMPLATE(bm_zobrist_incremental,   64);
+BENCHMARK_TEMPLATE(bm_zobrist_bulk,          64);
+BENCHMARK_TEMPLATE(bm_std_hash,             512);
+BENCHMARK_TEMPLATE(bm_zobrist_rehash,       512);
+BENCHMARK_TEMPLATE(bm_zobrist_incremental,  512);
+BENCHMARK_TEMPLATE(bm_zobrist_bulk,         512);
+
+BENCHMARK_MAIN();
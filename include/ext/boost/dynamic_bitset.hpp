@@ -66,12 +66,24 @@ struct find<boost::dynamic_bitset<Block, Allocator>>
 // isn't reachable via infix x <=> y - boost::dynamic_bitset<> is a real
 // (non-std) namespace so an ADL operator<=> here would be legal, but
 // ordering isn't unambiguous enough to be worth adding one - use
-// view(x) <=> view(y).
+// view(x) <=> view(y). For equal sizes, the order is decided at the first
+// set index n of x ^ y, with the same rule as std::bitset<N>'s compare<>:
+// the bitset containing n is the smaller one, unless the other one has
+// nothing after n. Different sizes fall back to iteration.
 template<std::unsigned_integral Block, class Allocator>
 struct compare<boost::dynamic_bitset<Block, Allocator>>
 {
         [[nodiscard]] static constexpr std::strong_ordering lexicographical_three_way(boost::dynamic_bitset<Block, Allocator> const& x, boost::dynamic_bitset<Block, Allocator> const& y) noexcept
         {
+                using bitset_type = boost::dynamic_bitset<Block, Allocator>;
+                if (x.size() == y.size()) {
+                        if (auto const n = (x ^ y).find_first(); n != bitset_type::npos) {
+                                auto const contains_n = x[n];
+                                auto const& rest = contains_n ? y : x;
+                                return contains_n == (rest.find_next(n) != bitset_type::npos) ? std::strong_ordering::less : std::strong_ordering::greater;
+                        }
+                        return std::strong_ordering::equal;
+                }
                 auto const xv = view(x);
                 auto const yv = view(y);
                 return std::lexicographical_compare_three_way(
@@ -102,12 +114,20 @@ struct find<boost::dynamic_bitset<Block, Allocator>>
 // at all (so compare<Bits>'s default x <=> y wouldn't even compile, let
 // alone be guaranteed to mean the same thing as this namespace's fixed-
 // length sequence-of-bool order) - opt in explicitly, same as
-// bidirectional::compare<boost::dynamic_bitset<...>> above.
+// bidirectional::compare<boost::dynamic_bitset<...>> above. For equal
+// sizes, the bitset with the first set index of x ^ y cleared is the
+// smaller one.
 template<std::unsigned_integral Block, class Allocator>
 struct compare<boost::dynamic_bitset<Block, Allocator>>
 {
         [[nodiscard]] static constexpr std::strong_ordering lexicographical_three_way(boost::dynamic_bitset<Block, Allocator> const& x, boost::dynamic_bitset<Block, Allocator> const& y) noexcept
         {
+                if (x.size() == y.size()) {
+                        if (auto const n = (x ^ y).find_first(); n != boost::dynamic_bitset<Block, Allocator>::npos) {
+                                return x[n] ? std::strong_ordering::greater : std::strong_ordering::less;
+                        }
+                        return std::strong_ordering::equal;
+                }
                 auto const xv = view(x);
                 auto const yv = view(y);
                 return std::lexicographical_compare_three_way(
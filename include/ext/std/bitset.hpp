@@ -67,20 +67,34 @@ struct find<std::bitset<N>>
 
 // std::bitset<N> has no <=> of its own, so xstd::proxy::bidirectional::
 // compare<Bits>'s default (trust Bits' own <=>) doesn't apply - it must opt
-// in to the safe, iteration-based ordering explicitly. This is what
+// in to the std::set<int>-equivalent ordering explicitly. This is what
 // view<std::bitset<N>>::operator<=> uses; there is no infix x <=> y for
 // std::bitset<N> itself (see the comment below on why that isn't added).
+// Where find<> above has _Find_first/_Find_next, the order is decided one
+// word at a time: at the first index n where x ^ y is set, the bitset
+// containing n is the smaller one, unless the other one has nothing after
+// n (it is then a proper prefix) - the same rule as bit::array's
+// set_three_way. Elsewhere, it falls back to iteration.
 template<std::size_t N>
 struct compare<std::bitset<N>>
 {
         [[nodiscard]] static constexpr std::strong_ordering lexicographical_three_way(std::bitset<N> const& x, std::bitset<N> const& y) noexcept
         {
-                auto const xv = view(x);
-                auto const yv = view(y);
-                return std::lexicographical_compare_three_way(
-                        xv.begin(), xv.end(),
-                        yv.begin(), yv.end()
-                );
+                if constexpr (requires { x._Find_first(); x._Find_next(0uz); }) {
+                        if (auto const n = (x ^ y)._Find_first(); n != N) {
+                                auto const contains_n = x[n];
+                                auto const& rest = contains_n ? y : x;
+                                return contains_n == (rest._Find_next(n) != N) ? std::strong_ordering::less : std::strong_ordering::greater;
+                        }
+                        return std::strong_ordering::equal;
+                } else {
+                        auto const xv = view(x);
+                        auto const yv = view(y);
+                        return std::lexicographical_compare_three_way(
+                                xv.begin(), xv.end(),
+                                yv.begin(), yv.end()
+                        );
+                }
         }
 };
 
@@ -106,18 +120,27 @@ struct find<std::bitset<N>>
 // compare<Bits>'s default (trust Bits' own <=>) can't apply here either -
 // same opt-in as bidirectional::compare<std::bitset<N>> above, just
 // producing the fixed-length sequence-of-bool order (index 0 first)
-// instead of the set-of-indices one.
+// instead of the set-of-indices one. With _Find_first, that order is
+// decided at the first index where x ^ y is set: the bitset with that bit
+// cleared is the smaller one.
 template<std::size_t N>
 struct compare<std::bitset<N>>
 {
         [[nodiscard]] static constexpr std::strong_ordering lexicographical_three_way(std::bitset<N> const& x, std::bitset<N> const& y) noexcept
         {
-                auto const xv = view(x);
-                auto const yv = view(y);
-                return std::lexicographical_compare_three_way(
-                        xv.begin(), xv.end(),
-                        yv.begin(), yv.end()
-                );
+                if constexpr (requires { x._Find_first(); }) {
+                        if (auto const n = (x ^ y)._Find_first(); n != N) {
+                                return x[n] ? std::strong_ordering::greater : std::strong_ordering::less;
+                        }
+                        return std::strong_ordering::equal;
+                } else {
+                        auto const xv = view(x);
+                        auto const yv = view(y);
+                        return std::lexicographical_compare_three_way(
+                                xv.begin(), xv.end(),
+                                yv.begin(), yv.end()
+                        );
+                }
         }
 };
 
@@ -0,0 +1,166 @@
+#pragma once
+
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit_array.hpp>   // add, bit_array
+#include <array>                // array
+#include <cassert>              // assert
+#include <concepts>             // unsigned_integral
+#include <cstddef>              // ptrdiff_t, size_t
+#include <ranges>               // iota
+#include <string_view>          // string_view
+#include <vector>               // vector
+
+// Bit-parallel edit distance (Myers 1999, Hyyrö 2003) for patterns of up to
+// N characters: column j of the dynamic programming matrix D[i][j] of
+// pattern prefix i versus text prefix j is encoded by its vertical deltas
+// D[i][j] - D[i - 1][j] in {-1, 0, +1} as two bit_arrays Pv and Mv, and
+// advanced to column j + 1 by a dozen bitwise operations and one addition.
+// The addition is bit_array's multi-block add, which chains the carry
+// through every block. The rows past the pattern are never read, and
+// nothing flows from them into the rows of the pattern: carries and shifts
+// only move towards higher rows.
+
+namespace xstd {
+
+template<std::size_t N, std::unsigned_integral Block = std::size_t>
+class edit_distance_pattern
+{
+        using vector_type = bit_array<N, Block>;
+
+        // Peq[c] holds the rows i of the pattern with pattern[i] == c.
+        std::array<vector_type, 256> m_peq{};
+        std::size_t m_size{};
+
+        struct state
+        {
+                vector_type Pv{};
+                vector_type Mv{};
+        };
+
+public:
+        explicit constexpr edit_distance_pattern(std::string_view pattern) noexcept
+        :
+                m_size(pattern.size())
+        {
+                assert(m_size <= N);
+                for (auto i : std::views::iota(0uz, m_size)) {
+                        m_peq[static_cast<unsigned char>(pattern[i])].m_bits.set(i);
+                }
+        }
+
+        [[nodiscard]] static constexpr auto capacity() noexcept { return N; }
+        [[nodiscard]] constexpr auto size() const noexcept { return m_size; }
+
+        // The Levenshtein distance between the pattern and text: the top
+        // row D[0][j] = j increases along the text.
+        [[nodiscard]] constexpr std::size_t distance(std::string_view text) const noexcept
+        {
+                auto s = initial_state();
+                auto score = m_size;
+                for (auto c : text) {
+                        score = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(score) + advance(s, c, true));
+                }
+                return score;
+        }
+
+        // The Levenshtein distance if at most k, or else k + 1, stopping as
+        // soon as the distance can no longer drop to k: every remaining
+        // text character decreases the score at the bottom row by at most one.
+        [[nodiscard]] constexpr std::size_t distance(std::string_view text, std::size_t k) const noexcept
+        {
+                auto const n = text.size();
+                if ((m_size > n ? m_size - n : n - m_size) > k) {
+                        return k + 1;
+                }
+                auto s = initial_state();
+                auto score = m_size;
+                for (auto j : std::views::iota(0uz, n)) {
+                        score = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(score) + advance(s, text[j], true));
+                        if (score > k + (n - j - 1)) {
+                                return k + 1;
+                        }
+                }
+                return score;
+        }
+
+        // The k-differences problem: the end positions j of the substrings
+        // text[i, j) within distance k of the pattern, for the top row
+        // D[0][j] = 0.
+        [[nodiscard]] constexpr auto search(std::string_view text, std::size_t k) const
+        {
+                auto matches = std::vector<std::size_t>();
+                auto s = initial_state();
+                auto score = m_size;
+                if (score <= k) {
+                        matches.push_back(0);
+                }
+                for (auto j : std::views::iota(0uz, text.size())) {
+                        score = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(score) + advance(s, text[j], false));
+                        if (score <= k) {
+                                matches.push_back(j + 1);
+                        }
+                }
+                return matches;
+        }
+
+private:
+        [[nodiscard]] static constexpr state initial_state() noexcept
+        {
+                state s;
+                s.Pv.fill(true);
+                return s;
+        }
+
+        // The rows one lower, with a zero shifted into the top row.
+        static constexpr void shift_down(vector_type& x) noexcept
+        {
+                if constexpr (N > 1) {
+                        x.m_bits <<= 1;
+                } else {
+                        x.m_bits.reset();
+                }
+        }
+
+        // Myers' advance: the next column for text character c, and the
+        // horizontal delta at the bottom row of the pattern. The horizontal
+        // delta at the top row is +1 if increasing, and 0 otherwise.
+        [[nodiscard]] constexpr std::ptrdiff_t advance(state& s, char c, bool increasing) const noexcept
+        {
+                if (m_size == 0) {
+                        return increasing ? 1 : 0;
+                }
+                auto const& Eq = m_peq[static_cast<unsigned char>(c)];
+                auto Xv = Eq;
+                Xv.m_bits |= s.Mv.m_bits;
+                auto Xh = Eq;
+                Xh.m_bits &= s.Pv.m_bits;
+                add(Xh, s.Pv);
+                Xh.m_bits ^= s.Pv.m_bits;
+                Xh.m_bits |= Eq.m_bits;
+                auto Ph = Xh;
+                Ph.m_bits |= s.Pv.m_bits;
+                Ph.m_bits.flip();
+                Ph.m_bits |= s.Mv.m_bits;
+                auto Mh = Xh;
+                Mh.m_bits &= s.Pv.m_bits;
+                auto const hout = Ph.m_bits[m_size - 1] ? 1z : Mh.m_bits[m_size - 1] ? -1z : 0z;
+                shift_down(Ph);
+                shift_down(Mh);
+                if (increasing) {
+                        Ph.m_bits.set(0);
+                }
+                s.Pv = Ph;
+                s.Pv.m_bits |= Xv.m_bits;
+                s.Pv.m_bits.flip();
+                s.Pv.m_bits |= Mh.m_bits;
+                s.Mv = Ph;
+                s.Mv.m_bits &= Xv.m_bits;
+                return hout;
+        }
+};
+
+}       // namespace xstd
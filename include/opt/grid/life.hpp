@@ -0,0 +1,234 @@
+#pragma once
+
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit_grid.hpp>    // direction
+#include <array>                // array
+#include <cstddef>              // ptrdiff_t, size_t
+#include <cstdint>              // uint16_t
+#include <ranges>               // iota
+#include <stdexcept>            // invalid_argument
+#include <string_view>          // string_view
+#include <utility>              // pair
+#include <vector>               // vector
+
+// Life-like cellular automata on a board of cells G (e.g. an xstd::bit_grid),
+// stepped one whole board of cells at a time: the eight neighbor images are
+// shifted copies of the board, and the neighbor counts of all cells are
+// bit-sliced into the four binary digit planes of a tree of full adders.
+
+namespace xstd {
+
+// Bit n of birth (survival) is set if a dead (live) cell with n live
+// neighbors is alive in the next generation.
+struct life_rule
+{
+        std::uint16_t birth;
+        std::uint16_t survival;
+};
+
+// The B/S notation, e.g. "B3/S23" for Conway's Game of Life.
+constexpr life_rule parse_life_rule(std::string_view notation)
+{
+        auto nrv = life_rule{};
+        auto* digits = &nrv.birth;
+        for (auto c : notation) {
+                if (c == 'B' or c == 'b') {
+                        digits = &nrv.birth;
+                } else if (c == 'S' or c == 's') {
+                        digits = &nrv.survival;
+                } else if ('0' <= c and c <= '8') {
+                        *digits = static_cast<std::uint16_t>(*digits | (1u << (c - '0')));
+                } else if (c != '/') {
+                        throw std::invalid_argument("life_rule: expected B/S notation");
+                }
+        }
+        return nrv;
+}
+
+inline constexpr auto conway   = parse_life_rule("B3/S23");
+inline constexpr auto highlife = parse_life_rule("B36/S23");
+inline constexpr auto seeds    = parse_life_rule("B2/S");
+
+template<class G>
+struct neighbor_count
+{
+        G ones, twos, fours, eights;
+};
+
+template<class G>
+constexpr auto half_add(G const& a, G const& b)
+{
+        return std::pair(a ^ b, a & b);
+}
+
+template<class G>
+constexpr auto full_add(G const& a, G const& b, G const& c)
+{
+        auto const t = a ^ b;
+        return std::pair(t ^ c, (a & b) | (t & c));
+}
+
+// The eight neighbor bits sum to ones + 2 * (c0 + c1 + c2 + c3), with the
+// four carries summing to twos + 2 * (f0 + f1), and f0 + f1 <= 2.
+template<class G>
+constexpr auto count_neighbors(std::array<G, 8> const& n)
+{
+        auto const [ s0, c0 ] = full_add(n[0], n[1], n[2]);
+        auto const [ s1, c1 ] = full_add(n[3], n[4], n[5]);
+        auto const [ s2, c2 ] = half_add(n[6], n[7]);
+        auto const [ ones, c3 ] = full_add(s0, s1, s2);
+        auto const [ t0, f0 ] = full_add(c0, c1, c2);
+        auto const [ twos, f1 ] = half_add(t0, c3);
+        return neighbor_count<G>{ ones, twos, f0 ^ f1, f0 & f1 };
+}
+
+// The cells that are alive in the next generation: an OR over the neighbor
+// counts n that the rule keeps alive, of the cells whose four count digits
+// match those of n. The rule is a template argument, so that the counts
+// that it never keeps alive cost nothing.
+template<life_rule Rule, class G>
+constexpr auto apply_rule(G const& alive, neighbor_count<G> const& count)
+{
+        auto const digits     = std::array{  count.ones,  count.twos,  count.fours,  count.eights };
+        auto const not_digits = std::array{ ~count.ones, ~count.twos, ~count.fours, ~count.eights };
+        G nrv;
+        for (auto n : std::views::iota(0uz, 9uz)) {
+                auto const born     = ((Rule.birth    >> n) & 1) != 0;
+                auto const survives = ((Rule.survival >> n) & 1) != 0;
+                if (not born and not survives) {
+                        continue;
+                }
+                auto match = (n & 1) ? digits[0] : not_digits[0];
+                for (auto k : std::views::iota(1uz, 4uz)) {
+                        match &= ((n >> k) & 1) ? digits[k] : not_digits[k];
+                }
+                if (born and survives) {
+                        nrv |= match;
+                } else if (born) {
+                        nrv |= match - alive;
+                } else {
+                        nrv |= match & alive;
+                }
+        }
+        return nrv;
+}
+
+// One generation of a bounded board, with all cells beyond its edges dead.
+template<life_rule Rule = conway, class G>
+constexpr auto life_step(G const& alive)
+{
+        return apply_rule<Rule>(alive, count_neighbors(std::array{
+                alive.template shift<direction::north     >(),
+                alive.template shift<direction::north_east>(),
+                alive.template shift<direction::east      >(),
+                alive.template shift<direction::south_east>(),
+                alive.template shift<direction::south     >(),
+                alive.template shift<direction::south_west>(),
+                alive.template shift<direction::west      >(),
+                alive.template shift<direction::north_west>()
+        }));
+}
+
+// A toroidal world of tiles_x by tiles_y boards G, stepped one tile at a
+// time so that the working set of every step stays in cache, however large
+// the world. A neighbor image of a tile is its own shifted copy, together
+// with the edge rows and columns translated in from the (up to three)
+// adjacent tiles in the opposite direction.
+template<class G>
+class life_world
+{
+        static constexpr auto W = static_cast<std::ptrdiff_t>(G::width);
+        static constexpr auto H = static_cast<std::ptrdiff_t>(G::height);
+
+        std::size_t m_tiles_x;
+        std::size_t m_tiles_y;
+        std::vector<G> m_tiles;
+        std::vector<G> m_next;
+
+public:
+        life_world(std::size_t tiles_x, std::size_t tiles_y)
+        :
+                m_tiles_x(tiles_x),
+                m_tiles_y(tiles_y),
+                m_tiles(tiles_x * tiles_y),
+                m_next(tiles_x * tiles_y)
+        {}
+
+        auto width()  const noexcept { return m_tiles_x * G::width;  }
+        auto height() const noexcept { return m_tiles_y * G::height; }
+
+        auto contains(std::size_t x, std::size_t y) const noexcept { return m_tiles[index(x, y)].contains(x % G::width, y % G::height); }
+        void insert  (std::size_t x, std::size_t y)       noexcept {        m_tiles[index(x, y)].insert  (x % G::width, y % G::height); }
+        void erase   (std::size_t x, std::size_t y)       noexcept {        m_tiles[index(x, y)].erase   (x % G::width, y % G::height); }
+
+        auto size() const noexcept
+        {
+                auto n = 0uz;
+                for (auto const& t : m_tiles) {
+                        n += t.size();
+                }
+                return n;
+        }
+
+        template<life_rule Rule = conway>
+        void step()
+        {
+                for (auto ty : std::views::iota(0uz, m_tiles_y)) {
+                        for (auto tx : std::views::iota(0uz, m_tiles_x)) {
+                                auto const x = static_cast<std::ptrdiff_t>(tx);
+                                auto const y = static_cast<std::ptrdiff_t>(ty);
+                                m_next[ty * m_tiles_x + tx] = apply_rule<Rule>(tile(x, y), count_neighbors(std::array{
+                                        image<direction::north     >(x, y),
+                                        image<direction::north_east>(x, y),
+                                        image<direction::east      >(x, y),
+                                        image<direction::south_east>(x, y),
+                                        image<direction::south     >(x, y),
+                                        image<direction::south_west>(x, y),
+                                        image<direction::west      >(x, y),
+                                        image<direction::north_west>(x, y)
+                                }));
+                        }
+                }
+                m_tiles.swap(m_next);
+        }
+
+private:
+        // The tile of cell (x, y).
+        auto index(std::size_t x, std::size_t y) const noexcept
+        {
+                return y / G::height * m_tiles_x + x / G::width;
+        }
+
+        auto const& tile(std::ptrdiff_t x, std::ptrdiff_t y) const noexcept
+        {
+                auto const tx = static_cast<std::size_t>((x + static_cast<std::ptrdiff_t>(m_tiles_x)) % static_cast<std::ptrdiff_t>(m_tiles_x));
+                auto const ty = static_cast<std::size_t>((y + static_cast<std::ptrdiff_t>(m_tiles_y)) % static_cast<std::ptrdiff_t>(m_tiles_y));
+                return m_tiles[ty * m_tiles_x + tx];
+        }
+
+        // The cell (i, j) of tile (x, y) sees the cell (i - dx, j - dy),
+        // which lies in the adjacent tile (x - dx, y - dy) when off the edge.
+        template<direction D>
+        auto image(std::ptrdiff_t x, std::ptrdiff_t y) const noexcept
+        {
+                constexpr auto dx = G::dx(D);
+                constexpr auto dy = G::dy(D);
+                auto nrv = tile(x, y).template translate<dx, dy>();
+                if constexpr (dx != 0) {
+                        nrv |= tile(x - dx, y).template translate<dx - dx * W, dy>();
+                }
+                if constexpr (dy != 0) {
+                        nrv |= tile(x, y - dy).template translate<dx, dy - dy * H>();
+                }
+                if constexpr (dx != 0 and dy != 0) {
+                        nrv |= tile(x - dx, y - dy).template translate<dx - dx * W, dy - dy * H>();
+                }
+                return nrv;
+        }
+};
+
+}       // namespace xstd
@@ -0,0 +1,280 @@
+#pragma once
+
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit/intrin.hpp>  // countr_zero, popcount
+#include <xstd/bit_set.hpp>     // bit_set
+#include <algorithm>            // copy, fill_n, lower_bound, max, min, sort, unique, upper_bound
+#include <concepts>             // same_as, totally_ordered, unsigned_integral
+#include <cstddef>              // ptrdiff_t, size_t
+#include <initializer_list>     // initializer_list
+#include <ranges>               // input_range, range_value_t
+                                // iota
+#include <stdexcept>            // length_error
+#include <vector>               // vector
+
+// A bitmap index over a column of at most N rows: one bit_set<N> per distinct
+// value, holding either the rows equal to that value (equality encoding) or
+// the rows less than or equal to it (range encoding, for which BETWEEN is a
+// single difference of two bitmaps, at the cost of equality lookups becoming
+// one too).
+//
+// Predicates (equal, in, between, combined with &, | and ~) compile to a
+// postfix program over the bitmaps. The evaluator runs the whole program over
+// one tile of 4096 rows at a time, so that every bitmap block is loaded once
+// and no intermediate bitmap is ever materialized: the result blocks are
+// written out as a bit_set, popcounted or decoded to row numbers on the fly.
+
+namespace xstd {
+
+enum class bitmap_encoding : std::size_t { equality, range };
+
+template<std::totally_ordered Value, std::size_t N, std::unsigned_integral Block = std::size_t>
+class bitmap_index
+{
+public:
+        using set_type = bit_set<N, Block>;
+
+        class query
+        {
+                friend bitmap_index;
+
+                enum class opcode : std::size_t { none, load, load_minus, load_union, complement, intersection, union_ };
+
+                struct instruction
+                {
+                        opcode op;
+                        std::size_t first = 0;
+                        std::size_t last = 0;
+                };
+
+                std::vector<instruction> m_program;
+                std::size_t m_depth = 1;        // the maximum stack depth of the program
+
+                explicit query(instruction i)
+                :
+                        m_program{ i }
+                {}
+
+                [[nodiscard]] static query binary(query lhs, query const& rhs, opcode op)
+                {
+                        lhs.m_depth = std::max(lhs.m_depth, rhs.m_depth + 1);
+                        lhs.m_program.insert(lhs.m_program.end(), rhs.m_program.begin(), rhs.m_program.end());
+                        lhs.m_program.push_back({ op });
+                        return lhs;
+                }
+
+        public:
+                [[nodiscard]] friend query operator&(query const& lhs, query const& rhs) { return binary(lhs, rhs, opcode::intersection); }
+                [[nodiscard]] friend query operator|(query const& lhs, query const& rhs) { return binary(lhs, rhs, opcode::union_);       }
+
+                [[nodiscard]] friend query operator~(query q)
+                {
+                        q.m_program.push_back({ opcode::complement });
+                        return q;
+                }
+        };
+
+private:
+        using instruction = typename query::instruction;
+        using opcode = typename query::opcode;
+
+        static constexpr auto bits_per_block = set_type::bits_per_block;
+        static constexpr auto tile_blocks    = 4096 / bits_per_block;
+
+        std::vector<Value> m_values;    // the sorted distinct values
+        std::vector<set_type> m_bitmaps;
+        std::size_t m_size = 0;
+        bitmap_encoding m_encoding;
+        set_type m_rows;                // the rows [0, size())
+
+public:
+        template<std::ranges::input_range R>
+                requires std::same_as<std::ranges::range_value_t<R>, Value>
+        explicit bitmap_index(R const& column, bitmap_encoding encoding = bitmap_encoding::equality)
+        :
+                m_encoding(encoding)
+        {
+                auto rows = std::vector<Value>();
+                for (auto const& v : column) {
+                        rows.push_back(v);
+                }
+                if (rows.size() > N) {
+                        throw std::length_error("bitmap_index: more than N rows");
+                }
+                m_values = rows;
+                std::ranges::sort(m_values);
+                m_values.erase(std::ranges::unique(m_values).begin(), m_values.end());
+
+                m_bitmaps.resize(m_values.size());
+                for (auto r : std::views::iota(0uz, rows.size())) {
+                        m_bitmaps[rank(rows[r])].insert(r);
+                        m_rows.insert(r);
+                }
+                if (m_encoding == bitmap_encoding::range and not m_bitmaps.empty()) {
+                        for (auto k : std::views::iota(1uz, m_bitmaps.size())) {
+                                m_bitmaps[k] |= m_bitmaps[k - 1];
+                        }
+                }
+                m_size = rows.size();
+        }
+
+        [[nodiscard]] auto size()     const noexcept { return m_size;          }
+        [[nodiscard]] auto distinct() const noexcept { return m_values.size(); }
+        [[nodiscard]] auto encoding() const noexcept { return m_encoding;      }
+
+        // The rows equal to v.
+        [[nodiscard]] query equal(Value const& v) const
+        {
+                auto const k = rank(v);
+                if (k == m_values.size() or m_values[k] != v) {
+                        return query({ opcode::none });
+                }
+                return values(k, k);
+        }
+
+        // The rows equal to any of vs.
+        [[nodiscard]] query in(std::initializer_list<Value> vs) const
+        {
+                auto q = query({ opcode::none });
+                for (auto const& v : vs) {
+                        q = q | equal(v);
+                }
+                return q;
+        }
+
+        // The rows with lo <= value <= hi.
+        [[nodiscard]] query between(Value const& lo, Value const& hi) const
+        {
+                auto const first = rank(lo);
+                auto const last = static_cast<std::size_t>(std::ranges::upper_bound(m_values, hi) - m_values.begin());
+                if (first >= last) {
+                        return query({ opcode::none });
+                }
+                return values(first, last - 1);
+        }
+
+        [[nodiscard]] set_type evaluate(query const& q) const
+        {
+                auto result = set_type();
+                run(q, [&](auto b, auto block) {
+                        set_block(result, b, block);
+                });
+                return result;
+        }
+
+        [[nodiscard]] std::size_t count(query const& q) const
+        {
+                auto n = 0uz;
+                run(q, [&](auto, auto block) {
+                        n += bit::popcount(block);
+                });
+                return n;
+        }
+
+        // The matching rows in increasing order.
+        [[nodiscard]] std::vector<std::size_t> rows(query const& q) const
+        {
+                auto result = std::vector<std::size_t>();
+                run(q, [&](auto b, auto block) {
+                        for (; block != 0; block &= static_cast<Block>(block - 1)) {
+                                result.push_back(b * bits_per_block + bit::countr_zero(block));
+                        }
+                });
+                return result;
+        }
+
+private:
+        [[nodiscard]] std::size_t rank(Value const& v) const
+        {
+                return static_cast<std::size_t>(std::ranges::lower_bound(m_values, v) - m_values.begin());
+        }
+
+        // The rows with a value among the distinct values [first, last].
+        [[nodiscard]] query values(std::size_t first, std::size_t last) const
+        {
+                if (m_encoding == bitmap_encoding::equality) {
+                        return query({ first == last ? opcode::load : opcode::load_union, first, last });
+                }
+                if (first == 0) {
+                        return query({ opcode::load, last });
+                }
+                return query({ opcode::load_minus, last, first - 1 });
+        }
+
+        // Calls fun(b, block) with every block b of the query result. The
+        // program runs over tiles of tile_blocks blocks, so that every
+        // instruction is an inner loop that vectorizes, while the stack of
+        // intermediate tiles stays in the L1 cache.
+        template<class BinaryFunction>
+        void run(query const& q, BinaryFunction fun) const
+        {
+                auto stack = std::vector<Block>(q.m_depth * tile_blocks);
+                auto const rows = blocks(m_rows);
+                for (auto first = 0uz; first < rows.size(); first += tile_blocks) {
+                        auto const n = std::min(tile_blocks, rows.size() - first);
+                        auto const tile = [&](set_type const& s) {
+                                return blocks(s).subspan(first, n);
+                        };
+                        auto top = stack.data();
+                        for (auto const& i : q.m_program) {
+                                switch (i.op) {
+                                case opcode::none:
+                                        std::ranges::fill_n(top, static_cast<std::ptrdiff_t>(n), Block(0));
+                                        top += tile_blocks;
+                                        break;
+                                case opcode::load:
+                                        std::ranges::copy(tile(m_bitmaps[i.first]), top);
+                                        top += tile_blocks;
+                                        break;
+                                case opcode::load_minus: {
+                                        auto const lhs = tile(m_bitmaps[i.first]);
+                                        auto const rhs = tile(m_bitmaps[i.last]);
+                                        for (auto j : std::views::iota(0uz, n)) {
+                                                top[j] = static_cast<Block>(lhs[j] & ~rhs[j]);
+                                        }
+                                        top += tile_blocks;
+                                        break;
+                                }
+                                case opcode::load_union:
+                                        std::ranges::copy(tile(m_bitmaps[i.first]), top);
+                                        for (auto k : std::views::iota(i.first + 1, i.last + 1)) {
+                                                auto const src = tile(m_bitmaps[k]);
+                                                for (auto j : std::views::iota(0uz, n)) {
+                                                        top[j] |= src[j];
+                                                }
+                                        }
+                                        top += tile_blocks;
+                                        break;
+                                case opcode::complement: {
+                                        auto const dst = top - tile_blocks;
+                                        for (auto j : std::views::iota(0uz, n)) {
+                                                dst[j] = static_cast<Block>(~dst[j] & rows[first + j]);
+                                        }
+                                        break;
+                                }
+                                case opcode::intersection:
+                                        top -= tile_blocks;
+                                        for (auto j : std::views::iota(0uz, n)) {
+                                                (top - tile_blocks)[j] &= top[j];
+                                        }
+                                        break;
+                                case opcode::union_:
+                                        top -= tile_blocks;
+                                        for (auto j : std::views::iota(0uz, n)) {
+                                                (top - tile_blocks)[j] |= top[j];
+                                        }
+                                        break;
+                                }
+                        }
+                        for (auto j : std::views::iota(0uz, n)) {
+                                fun(first + j, stack[j]);
+                        }
+                }
+        }
+};
+
+}       // namespace xstd
@@ -0,0 +1,233 @@
+#pragma once
+
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>    // stable_sort
+#include <cstddef>      // size_t
+#include <random>       // bernoulli_distribution
+#include <ranges>       // iota
+#include <utility>      // pair
+#include <vector>       // vector
+
+// Bit-parallel graph algorithms on an adjacency matrix of sets: row v holds
+// the neighbors of vertex v (and never v itself), for the vertices [0, n)
+// with n <= X::max_size(). Every inner loop below is a set-algebra kernel on
+// a whole row (&=, -=, size(), front()), never a loop over single vertices.
+
+namespace xstd {
+
+template<class X>
+auto make_graph(std::size_t n, auto const& edges)
+{
+        auto adj = std::vector<X>(n);
+        for (auto [ u, v ] : edges) {
+                if (u != v) {
+                        adj[u].insert(v);
+                        adj[v].insert(u);
+                }
+        }
+        return adj;
+}
+
+// The G(n, p) random graphs of the DIMACS "C" and "p_hat"-style families:
+// every one of the n * (n - 1) / 2 edges is independently present with
+// probability p.
+template<class X>
+auto make_random_graph(std::size_t n, double p, auto& urbg)
+{
+        auto adj = std::vector<X>(n);
+        auto coin = std::bernoulli_distribution(p);
+        for (auto v : std::views::iota(0uz, n)) {
+                for (auto u : std::views::iota(0uz, v)) {
+                        if (coin(urbg)) {
+                                adj[u].insert(v);
+                                adj[v].insert(u);
+                        }
+                }
+        }
+        return adj;
+}
+
+template<class X>
+auto all_vertices(std::vector<X> const& adj)
+{
+        X vertices;
+        for (auto v : std::views::iota(0uz, adj.size())) {
+                vertices.insert(v);
+        }
+        return vertices;
+}
+
+// Branch-and-bound maximum clique search in the style of San Segundo's BBMC.
+// The vertices are first renumbered by non-increasing degree, so that the
+// greedy coloring bound (which scans candidates in index order) colors the
+// hardest-constrained vertices first. Each coloring class is then peeled off
+// the candidate set by repeatedly removing the first candidate's whole
+// neighborhood with a single -=, and branching proceeds in reverse coloring
+// order, pruning as soon as the current clique plus the color number of the
+// remaining candidates can no longer beat the incumbent.
+template<class X>
+class max_clique_search
+{
+        std::vector<X> m_adj;
+        std::vector<std::size_t> m_label;
+        std::vector<std::vector<std::pair<std::size_t, std::size_t>>> m_order;
+        std::size_t m_clique_size{};
+        std::size_t m_best_size{};
+        X m_clique{};
+        X m_best{};
+
+public:
+        explicit max_clique_search(std::vector<X> const& adj)
+        :
+                m_adj(adj.size()),
+                m_label(adj.size())
+        {
+                auto const n = adj.size();
+                for (auto v : std::views::iota(0uz, n)) {
+                        m_label[v] = v;
+                }
+                std::ranges::stable_sort(m_label, [&](auto lhs, auto rhs) {
+                        return adj[lhs].size() > adj[rhs].size();
+                });
+                auto index = std::vector<std::size_t>(n);
+                for (auto v : std::views::iota(0uz, n)) {
+                        index[m_label[v]] = v;
+                }
+                for (auto v : std::views::iota(0uz, n)) {
+                        for (std::size_t u : adj[m_label[v]]) {
+                                m_adj[v].insert(index[u]);
+                        }
+                }
+        }
+
+        auto operator()()
+        {
+                m_clique.clear();
+                m_best.clear();
+                m_clique_size = m_best_size = 0;
+                expand(all_vertices(m_adj), 0);
+
+                X clique;
+                for (std::size_t v : m_best) {
+                        clique.insert(m_label[v]);
+                }
+                return clique;
+        }
+
+private:
+        // Sequential greedy coloring of the candidates P: color class k is
+        // grown from the remaining candidates Q by taking the first one and
+        // discarding all of its neighbors at once.
+        void color(X P, std::vector<std::pair<std::size_t, std::size_t>>& order) const
+        {
+                order.clear();
+                for (auto k = 1uz; not P.empty(); ++k) {
+                        auto Q = P;
+                        do {
+                                std::size_t const v = Q.front();
+                                Q -= m_adj[v];
+                                Q.erase(v);
+                                P.erase(v);
+                                order.emplace_back(v, k);
+                        } while (not Q.empty());
+                }
+        }
+
+        void expand(X P, std::size_t depth)
+        {
+                if (m_order.size() == depth) {
+                        m_order.emplace_back();
+                }
+                color(P, m_order[depth]);
+                // m_order may reallocate in the recursive calls below,
+                // so index it afresh instead of holding on to a reference.
+                for (auto i = m_order[depth].size(); i-- > 0;) {
+                        auto const [ v, k ] = m_order[depth][i];
+                        if (m_clique_size + k <= m_best_size) {
+                                return;
+                        }
+                        m_clique.insert(v);
+                        ++m_clique_size;
+                        if (auto const candidates = P & m_adj[v]; candidates.empty()) {
+                                if (m_clique_size > m_best_size) {
+                                        m_best = m_clique;
+                                        m_best_size = m_clique_size;
+                                }
+                        } else {
+                                expand(candidates, depth + 1);
+                        }
+                        m_clique.erase(v);
+                        --m_clique_size;
+                        P.erase(v);
+                }
+        }
+};
+
+template<class X>
+auto max_clique(std::vector<X> const& adj)
+{
+        return max_clique_search<X>(adj)();
+}
+
+template<class X>
+auto is_clique(std::vector<X> const& adj, X const& clique)
+{
+        for (std::size_t v : clique) {
+                auto others = clique;
+                others.erase(v);
+                if (not others.is_subset_of(adj[v])) {
+                        return false;
+                }
+        }
+        return true;
+}
+
+// Brélaz's DSATUR heuristic: repeatedly color the uncolored vertex whose
+// neighbors already use the most distinct colors (ties broken by degree in
+// the uncolored subgraph) with the smallest color none of them uses. The
+// colors forbidden at each vertex are themselves kept as a set, so that the
+// saturation degree is a size() and the smallest free color a front().
+template<class X>
+auto dsatur_coloring(std::vector<X> const& adj)
+{
+        auto const n = adj.size();
+        auto coloring = std::vector<std::size_t>(n);
+        auto forbidden = std::vector<X>(n);
+        auto uncolored = all_vertices(adj);
+        while (not uncolored.empty()) {
+                std::size_t v = uncolored.front();
+                auto key = std::pair(forbidden[v].size(), (adj[v] & uncolored).size());
+                for (std::size_t u : uncolored) {
+                        if (auto const candidate = std::pair(forbidden[u].size(), (adj[u] & uncolored).size()); candidate > key) {
+                                v = u;
+                                key = candidate;
+                        }
+                }
+                std::size_t const c = (~forbidden[v]).front();
+                coloring[v] = c;
+                uncolored.erase(v);
+                for (std::size_t u : adj[v] & uncolored) {
+                        forbidden[u].insert(c);
+                }
+        }
+        return coloring;
+}
+
+template<class X>
+auto is_proper_coloring(std::vector<X> const& adj, std::vector<std::size_t> const& coloring)
+{
+        for (auto v : std::views::iota(0uz, adj.size())) {
+                for (std::size_t u : adj[v]) {
+                        if (coloring[u] == coloring[v]) {
+                                return false;
+                        }
+                }
+        }
+        return true;
+}
+
+}       // namespace xstd
@@ -0,0 +1,233 @@
+#pragma once
+
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit/intrin.hpp>  // countr_zero
+#include <xstd/bit_set.hpp>     // bit_set
+#include <algorithm>            // sort
+#include <array>                // array
+#include <concepts>             // same_as, unsigned_integral
+#include <cstddef>              // size_t
+#include <ranges>               // forward_range, input_range, range_value_t
+                                // iota
+#include <vector>               // vector
+
+// Superset and subset queries over a growing collection of sets.
+//
+// Supersets come from an inverted index: for every element e, a posting
+// bitmap over the set ids with bit i set if set i contains e, so that
+//
+//      supersets(q) = AND over e in q of postings[e]
+//
+// Above every posting bitmap sits a summary bitmap with bit b set if block
+// b of the postings is non-zero. A superset query first ANDs the summaries,
+// rarest element first, so that every summary block rules out up to
+// bits_per_block^2 ids at once, and then only visits the posting blocks
+// that survive. Posting bitmaps only grow as far as their last set bit, and
+// blocks past their end read as zero.
+//
+// Subsets come from pivots: every non-empty set is stored in the list of its
+// rarest element at the time of insertion, and can only be contained in q if
+// that element is in q. A subset query therefore only visits the lists of
+// the elements of q, and tests those candidates with is_subset_of in one
+// sequential pass per list. Rare pivots make for short lists that queries
+// rarely visit.
+
+namespace xstd {
+
+template<std::size_t N, std::unsigned_integral Block = std::size_t>
+class containment_index
+{
+public:
+        using set_type = bit_set<N, Block>;
+
+private:
+        static constexpr auto bits_per_block = set_type::bits_per_block;
+
+        std::array<std::vector<Block>, N> m_postings;
+        std::array<std::vector<Block>, N> m_summaries;
+        std::array<std::vector<std::size_t>, N> m_pivot_ids;   // the ids of the sets with rarest element e
+        std::array<std::vector<set_type>, N> m_pivot_sets;      // the sets with rarest element e
+        std::vector<std::size_t> m_empty;                       // the ids of the empty sets
+        std::array<std::size_t, N> m_counts{};                  // the number of sets containing e
+        std::size_t m_size = 0;
+
+        [[nodiscard]] static constexpr std::size_t num_blocks(std::size_t n) noexcept
+        {
+                return (n + bits_per_block - 1) / bits_per_block;
+        }
+
+        [[nodiscard]] static constexpr Block bit(std::size_t n) noexcept
+        {
+                return static_cast<Block>(static_cast<Block>(1) << (n % bits_per_block));
+        }
+
+        static void set(std::vector<Block>& bitmap, std::size_t n)
+        {
+                if (auto const b = n / bits_per_block; b >= bitmap.size()) {
+                        bitmap.resize(b + 1);
+                }
+                bitmap[n / bits_per_block] |= bit(n);
+        }
+
+        [[nodiscard]] static Block block_at(std::vector<Block> const& bitmap, std::size_t b) noexcept
+        {
+                return b < bitmap.size() ? bitmap[b] : static_cast<Block>(0);
+        }
+
+        template<class UnaryFunction>
+        static void for_each_bit(std::size_t b, Block block, UnaryFunction fun)
+        {
+                for (; block != 0; block &= static_cast<Block>(block - 1)) {
+                        fun(b * bits_per_block + bit::countr_zero(block));
+                }
+        }
+
+        // The elements of s, rarest first.
+        [[nodiscard]] std::vector<std::size_t> by_frequency(set_type const& s) const
+        {
+                auto elements = std::vector<std::size_t>();
+                for_each_element(s, [&](auto e) {
+                        elements.push_back(e);
+                });
+                std::ranges::sort(elements, {}, [&](auto e) { return m_counts[e]; });
+                return elements;
+        }
+
+        template<class UnaryFunction>
+        static void for_each_element(set_type const& s, UnaryFunction fun)
+        {
+                auto const bs = blocks(s);
+                for (auto b : std::views::iota(0uz, bs.size())) {
+                        for_each_bit(b, bs[b], fun);
+                }
+        }
+
+        void count(set_type const& s) noexcept
+        {
+                for_each_element(s, [&](auto e) {
+                        ++m_counts[e];
+                });
+        }
+
+        std::size_t place(set_type const& s)
+        {
+                auto const id = size();
+                auto pivot = N;
+                for_each_element(s, [&](auto e) {
+                        set(m_postings[e], id);
+                        set(m_summaries[e], id / bits_per_block);
+                        if (pivot == N or m_counts[e] < m_counts[pivot]) {
+                                pivot = e;
+                        }
+                });
+                if (pivot == N) {
+                        m_empty.push_back(id);
+                } else {
+                        m_pivot_ids[pivot].push_back(id);
+                        m_pivot_sets[pivot].push_back(s);
+                }
+                ++m_size;
+                return id;
+        }
+
+public:
+        containment_index() = default;
+
+        template<std::ranges::input_range R>
+                requires std::same_as<std::ranges::range_value_t<R>, set_type>
+        explicit containment_index(R const& sets)
+        {
+                insert(sets);
+        }
+
+        [[nodiscard]] auto size() const noexcept { return m_size; }
+
+        // Inserts s with the next id, and returns it.
+        std::size_t insert(set_type const& s)
+        {
+                count(s);
+                return place(s);
+        }
+
+        // Inserts all sets with consecutive ids. For a forward range, a first
+        // pass counts the elements of the whole batch, so that every set
+        // gets its pivot from the final frequencies and every posting bitmap
+        // is reallocated at most once.
+        template<std::ranges::input_range R>
+                requires std::same_as<std::ranges::range_value_t<R>, set_type>
+        void insert(R const& sets)
+        {
+                if constexpr (std::ranges::forward_range<R>) {
+                        auto present = set_type();
+                        auto n = size();
+                        for (auto const& s : sets) {
+                                count(s);
+                                present |= s;
+                                ++n;
+                        }
+                        for_each_element(present, [&](auto e) {
+                                m_postings[e].reserve(num_blocks(n));
+                                m_summaries[e].reserve(num_blocks(num_blocks(n)));
+                        });
+                        for (auto const& s : sets) {
+                                place(s);
+                        }
+                } else {
+                        for (auto const& s : sets) {
+                                insert(s);
+                        }
+                }
+        }
+
+        // The ids of the sets containing q, in increasing order.
+        [[nodiscard]] std::vector<std::size_t> supersets(set_type const& q) const
+        {
+                auto ids = std::vector<std::size_t>();
+                auto const elements = by_frequency(q);
+                if (elements.empty()) {
+                        for (auto id : std::views::iota(0uz, size())) {
+                                ids.push_back(id);
+                        }
+                        return ids;
+                }
+                auto const& rarest = m_summaries[elements.front()];
+                for (auto w : std::views::iota(0uz, rarest.size())) {
+                        auto summary = rarest[w];
+                        for (auto k = 1uz; k < elements.size() and summary != 0; ++k) {
+                                summary &= block_at(m_summaries[elements[k]], w);
+                        }
+                        for_each_bit(w, summary, [&](auto b) {
+                                auto block = m_postings[elements.front()][b];
+                                for (auto k = 1uz; k < elements.size() and block != 0; ++k) {
+                                        block &= m_postings[elements[k]][b];
+                                }
+                                for_each_bit(b, block, [&](auto id) {
+                                        ids.push_back(id);
+                                });
+                        });
+                }
+                return ids;
+        }
+
+        // The ids of the sets contained in q, in increasing order.
+        [[nodiscard]] std::vector<std::size_t> subsets(set_type const& q) const
+        {
+                auto ids = m_empty;
+                for_each_element(q, [&](auto e) {
+                        auto const& sets = m_pivot_sets[e];
+                        for (auto i : std::views::iota(0uz, sets.size())) {
+                                if (sets[i].is_subset_of(q)) {
+                                        ids.push_back(m_pivot_ids[e][i]);
+                                }
+                        }
+                });
+                std::ranges::sort(ids);
+                return ids;
+        }
+};
+
+}       // namespace xstd
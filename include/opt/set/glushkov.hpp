@@ -0,0 +1,401 @@
+#pragma once
+
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit/intrin.hpp>  // countr_zero
+#include <xstd/bit_set.hpp>     // bit_set
+#include <array>                // array
+#include <concepts>             // unsigned_integral
+#include <cstddef>              // size_t
+#include <initializer_list>     // initializer_list
+#include <ranges>               // input_range
+                                // iota
+#include <span>                 // span
+#include <stdexcept>            // invalid_argument, length_error
+#include <string>               // string
+#include <string_view>          // string_view
+#include <utility>              // pair
+#include <vector>               // vector
+
+// Bit-parallel simulation of Glushkov automata (Navarro and Raffinot): every
+// character class occurrence in a rule is one NFA state, numbered in textual
+// order, and all transitions into a state read that state's class. The set D
+// of active states advances per text character c as
+//
+//      D = (((D << 1) & forward) | exceptions(D) | first) & masks[c]
+//
+// where the shift covers the transitions from state i to state i + 1 that
+// concatenation produces, and exceptions(D) ORs together the targets of all
+// other transitions (alternatives, loops) by table lookups on the bytes of D
+// that hold their sources. Rules are matched anywhere in the text: the first
+// states of every rule are entered at every position.
+//
+// The rule syntax is a regular expression subset: literals, '.', classes
+// [a-z0-9_] and [^...], the escapes \d, \w and \s (or any escaped literal),
+// grouping with (), alternation with | and the postfix operators *, + and ?.
+
+namespace xstd {
+
+template<std::size_t N, std::unsigned_integral Block = std::size_t>
+class glushkov_matcher
+{
+        using set_type = bit_set<N, Block>;
+        using char_class = std::array<bool, 256>;
+
+        static constexpr auto bits_per_block = set_type::bits_per_block;
+        static constexpr auto chunk_size     = 8uz;
+
+        std::array<set_type, 256> m_masks{};    // the states reading character c
+        set_type m_first{};                     // the first states of every rule
+        set_type m_forward{};                   // the states i + 1 following state i
+        set_type m_last{};                      // the accepting states
+        std::vector<std::size_t> m_rule_of;     // the rule of every state
+        std::vector<std::size_t> m_chunks;      // the bytes of D holding exception sources
+        std::vector<set_type> m_exceptions;     // 256 exception target sets per chunk
+        set_type m_state{};
+        std::size_t m_position{};
+
+        struct fragment
+        {
+                set_type first{};
+                set_type last{};
+                Block nullable = 1;     // a whole block, so that fragment has no padding
+        };
+
+        // Recursive descent over a single rule, collecting the Glushkov
+        // first, last and follow sets bottom-up.
+        class parser
+        {
+                glushkov_matcher& m_nfa;
+                std::vector<set_type>& m_follow;
+                std::string_view m_rule;
+                std::size_t m_pos{};
+
+        public:
+                parser(glushkov_matcher& nfa, std::vector<set_type>& follow, std::string_view rule) noexcept
+                :
+                        m_nfa(nfa),
+                        m_follow(follow),
+                        m_rule(rule)
+                {}
+
+                fragment parse()
+                {
+                        auto f = alternation();
+                        if (m_pos != m_rule.size()) {
+                                error("unbalanced ')'");
+                        }
+                        return f;
+                }
+
+        private:
+                [[noreturn]] void error(std::string const& what) const
+                {
+                        throw std::invalid_argument("glushkov_matcher: " + what + " at offset " + std::to_string(m_pos) + " of \"" + std::string(m_rule) + "\"");
+                }
+
+                [[nodiscard]] bool at_end() const noexcept { return m_pos == m_rule.size(); }
+                [[nodiscard]] char peek() const noexcept { return m_rule[m_pos]; }
+
+                fragment alternation()
+                {
+                        auto f = concatenation();
+                        while (not at_end() and peek() == '|') {
+                                ++m_pos;
+                                auto const g = concatenation();
+                                f.first |= g.first;
+                                f.last |= g.last;
+                                f.nullable = f.nullable or g.nullable;
+                        }
+                        return f;
+                }
+
+                fragment concatenation()
+                {
+                        auto f = fragment();
+                        while (not at_end() and peek() != '|' and peek() != ')') {
+                                auto const g = repetition();
+                                for (auto i : f.last) {
+                                        m_follow[i] |= g.first;
+                                }
+                                if (f.nullable) {
+                                        f.first |= g.first;
+                                }
+                                if (g.nullable) {
+                                        f.last |= g.last;
+                                } else {
+                                        f.last = g.last;
+                                }
+                                f.nullable = f.nullable and g.nullable;
+                        }
+                        return f;
+                }
+
+                fragment repetition()
+                {
+                        auto f = atom();
+                        while (not at_end() and (peek() == '*' or peek() == '+' or peek() == '?')) {
+                                auto const op = m_rule[m_pos++];
+                                if (op != '?') {
+                                        for (auto i : f.last) {
+                                                m_follow[i] |= f.first;
+                                        }
+                                }
+                                if (op != '+') {
+                                        f.nullable = true;
+                                }
+                        }
+                        return f;
+                }
+
+                fragment atom()
+                {
+                        switch (auto const c = m_rule[m_pos++]; c) {
+                        case '(': {
+                                auto f = alternation();
+                                if (at_end() or m_rule[m_pos++] != ')') {
+                                        error("missing ')'");
+                                }
+                                return f;
+                        }
+                        case '*': case '+': case '?':
+                                --m_pos;
+                                error("nothing to repeat");
+                        case '.':
+                                return symbol(all());
+                        case '[':
+                                return symbol(bracket());
+                        case '\\':
+                                return symbol(escape());
+                        default:
+                                return symbol(single(c));
+                        }
+                }
+
+                fragment symbol(char_class const& cc)
+                {
+                        auto const state = m_nfa.m_rule_of.size();
+                        if (state == N) {
+                                throw std::length_error("glushkov_matcher: rules exceed N states");
+                        }
+                        for (auto c : std::views::iota(0uz, cc.size())) {
+                                if (cc[c]) {
+                                        m_nfa.m_masks[c].insert(state);
+                                }
+                        }
+                        m_nfa.m_rule_of.push_back(0);
+                        auto f = fragment();
+                        f.first.insert(state);
+                        f.last.insert(state);
+                        f.nullable = false;
+                        return f;
+                }
+
+                static char_class single(char c) noexcept
+                {
+                        auto cc = char_class();
+                        cc[static_cast<unsigned char>(c)] = true;
+                        return cc;
+                }
+
+                static char_class all() noexcept
+                {
+                        auto cc = char_class();
+                        cc.fill(true);
+                        return cc;
+                }
+
+                static void add_range(char_class& cc, unsigned char lo, unsigned char hi) noexcept
+                {
+                        for (auto c : std::views::iota(0uz + lo, 1uz + hi)) {
+                                cc[c] = true;
+                        }
+                }
+
+                char_class escape()
+                {
+                        if (at_end()) {
+                                error("trailing '\\'");
+                        }
+                        auto cc = char_class();
+                        switch (auto const c = m_rule[m_pos++]; c) {
+                        case 'd':
+                                add_range(cc, '0', '9');
+                                break;
+                        case 'w':
+                                add_range(cc, '0', '9');
+                                add_range(cc, 'A', 'Z');
+                                add_range(cc, 'a', 'z');
+                                cc['_'] = true;
+                                break;
+                        case 's':
+                                for (auto ws : std::string_view(" \t\n\v\f\r")) {
+                                        cc[static_cast<unsigned char>(ws)] = true;
+                                }
+                                break;
+                        default:
+                                cc = single(c);
+                        }
+                        return cc;
+                }
+
+                char_class bracket()
+                {
+                        auto cc = char_class();
+                        auto const negated = not at_end() and peek() == '^';
+                        if (negated) {
+                                ++m_pos;
+                        }
+                        for (auto first = true; ; first = false) {
+                                if (at_end()) {
+                                        error("missing ']'");
+                                }
+                                if (peek() == ']' and not first) {
+                                        ++m_pos;
+                                        break;
+                                }
+                                if (peek() == '\\') {
+                                        ++m_pos;
+                                        auto const e = escape();
+                                        for (auto c : std::views::iota(0uz, cc.size())) {
+                                                cc[c] = cc[c] or e[c];
+                                        }
+                                        continue;
+                                }
+                                auto const lo = static_cast<unsigned char>(m_rule[m_pos++]);
+                                if (m_pos + 1 < m_rule.size() and peek() == '-' and m_rule[m_pos + 1] != ']') {
+                                        auto const hi = static_cast<unsigned char>(m_rule[m_pos + 1]);
+                                        if (hi < lo) {
+                                                error("invalid range");
+                                        }
+                                        m_pos += 2;
+                                        add_range(cc, lo, hi);
+                                } else {
+                                        cc[lo] = true;
+                                }
+                        }
+                        if (negated) {
+                                for (auto& b : cc) {
+                                        b = not b;
+                                }
+                        }
+                        return cc;
+                }
+        };
+
+public:
+        explicit glushkov_matcher(std::initializer_list<std::string_view> rules)
+        :
+                glushkov_matcher(std::span(rules.begin(), rules.size()))
+        {}
+
+        template<std::ranges::input_range R>
+        explicit glushkov_matcher(R const& rules)
+        {
+                auto follow = std::vector<set_type>(N);
+                auto r = 0uz;
+                for (std::string_view rule : rules) {
+                        auto const f = parser(*this, follow, rule).parse();
+                        if (f.nullable) {
+                                throw std::invalid_argument("glushkov_matcher: rule \"" + std::string(rule) + "\" matches the empty string");
+                        }
+                        m_first |= f.first;
+                        m_last |= f.last;
+                        for (auto i : f.last) {
+                                m_rule_of[i] = r;
+                        }
+                        ++r;
+                }
+
+                // Split off the transitions from i to i + 1, and tabulate the
+                // remaining ones per byte of sources, lowest source first.
+                auto sources = set_type();
+                for (auto i : std::views::iota(0uz, m_rule_of.size())) {
+                        if (i + 1 < N and follow[i].contains(i + 1)) {
+                                m_forward.insert(i + 1);
+                                follow[i].erase(i + 1);
+                        }
+                        if (not follow[i].empty()) {
+                                sources.insert(i);
+                        }
+                }
+                for (auto i : sources) {
+                        auto const chunk = i / chunk_size;
+                        if (not m_chunks.empty() and m_chunks.back() == chunk) {
+                                continue;
+                        }
+                        m_chunks.push_back(chunk);
+                        m_exceptions.resize(m_exceptions.size() + 256);
+                        auto const table = std::span(m_exceptions).last(256);
+                        for (auto v : std::views::iota(1uz, 256uz)) {
+                                auto const j = bit::countr_zero(v);
+                                table[v] = table[v & (v - 1)];
+                                if (auto const s = chunk * chunk_size + j; s < N) {
+                                        table[v] |= follow[s];
+                                }
+                        }
+                }
+        }
+
+        // The number of NFA states over all rules.
+        [[nodiscard]] auto size() const noexcept { return m_rule_of.size(); }
+
+        // The number of characters fed so far.
+        [[nodiscard]] auto position() const noexcept { return m_position; }
+
+        void reset() noexcept
+        {
+                m_state.clear();
+                m_position = 0;
+        }
+
+        // Scans the next chunk of a text stream, so that matches may straddle
+        // chunks, and calls fun(end, r) for every match of rule r ending just
+        // before stream position end (once per end position and rule).
+        void feed(std::span<char const> text, auto fun)
+        {
+                for (auto c : text) {
+                        auto next = set_type();
+                        if constexpr (N > 1) {
+                                next = m_state << 1;    // bit_set<1> can't be shifted by 1
+                                next &= m_forward;
+                        }
+                        next |= m_first;
+                        auto const state = blocks(m_state);
+                        for (auto k : std::views::iota(0uz, m_chunks.size())) {
+                                auto const bit = m_chunks[k] * chunk_size;
+                                if (auto const byte = static_cast<std::size_t>(state[bit / bits_per_block] >> (bit % bits_per_block)) & 0xFF; byte != 0) {
+                                        next |= m_exceptions[256 * k + byte];
+                                }
+                        }
+                        next &= m_masks[static_cast<unsigned char>(c)];
+                        m_state = next;
+                        ++m_position;
+                        if (m_state.intersects(m_last)) [[unlikely]] {
+                                auto const hits = m_state & m_last;
+                                auto previous = m_rule_of.size();
+                                for (auto n = find_first(hits); n != N; n = find_next(hits, n)) {
+                                        if (m_rule_of[n] != previous) {
+                                                fun(m_position, m_rule_of[n]);
+                                                previous = m_rule_of[n];
+                                        }
+                                }
+                        }
+                }
+        }
+
+        // All (end, r) pairs of the next chunk, in order of end position.
+        [[nodiscard]] auto feed(std::span<char const> text)
+        {
+                auto matches = std::vector<std::pair<std::size_t, std::size_t>>();
+                feed(text, [&](auto end, auto r) {
+                        matches.emplace_back(end, r);
+                });
+                return matches;
+        }
+};
+
+}       // namespace xstd
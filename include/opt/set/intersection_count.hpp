@@ -0,0 +1,31 @@
+#pragma once
+
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit/intrin.hpp>  // popcount
+#include <xstd/bit_set.hpp>     // bit_set
+#include <concepts>             // unsigned_integral
+#include <cstddef>              // size_t
+#include <ranges>               // iota
+
+namespace xstd {
+
+// The intersection count |a & b| as a single fused pass of ANDs and popcounts
+// over the blocks, without materializing a & b. The core of every similarity
+// measure between sets (Jaccard, Tanimoto, Hamming).
+template<std::size_t N, std::unsigned_integral Block>
+[[nodiscard]] constexpr std::size_t intersection_count(bit_set<N, Block> const& lhs, bit_set<N, Block> const& rhs) noexcept
+{
+        auto const a = blocks(lhs);
+        auto const b = blocks(rhs);
+        auto n = 0uz;
+        for (auto i : std::views::iota(0uz, a.size())) {
+                n += bit::popcount(static_cast<Block>(a[i] & b[i]));
+        }
+        return n;
+}
+
+}       // namespace xstd
@@ -0,0 +1,264 @@
+#pragma once
+
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <opt/set/intersection_count.hpp>  // intersection_count
+#include <xstd/bit/hash.hpp>               // mix, splitmix64
+#include <xstd/bit/intrin.hpp>             // countr_zero, popcount
+#include <xstd/bit_set.hpp>                // bit_set
+#include <algorithm>                       // clamp, equal_range, find_if, min, sort, unique
+#include <array>                           // array
+#include <bit>                             // has_single_bit
+#include <compare>                         // is_eq, weak_order
+#include <concepts>                        // same_as, unsigned_integral
+#include <cstddef>                         // size_t
+#include <cstdint>                         // uint32_t, uint64_t
+#include <iterator>                        // next
+#include <limits>                          // max
+#include <ranges>                          // input_range, range_value_t
+                                           // iota
+#include <utility>                         // pair
+#include <vector>                          // vector
+
+// MinHash signatures (Broder), b-bit MinHash (Li and König) and banded
+// locality sensitive hashing for approximate Jaccard similarity joins.
+//
+// The i-th signature value of a set is the minimum of the i-th hash function
+// over its elements, and two signature values agree with a probability
+// equal to the Jaccard similarity of the sets. The elements are decoded one
+// block at a time (countr_zero, then clearing the lowest bit), and every
+// element is mixed once and then rehashed by K multiply-shift functions in
+// a loop that vectorizes.
+
+namespace xstd {
+namespace detail {
+
+[[nodiscard]] inline double jaccard(std::size_t a, std::size_t b, std::size_t c) noexcept
+{
+        auto const u = a + b - c;
+        return u == 0 ? 1.0 : static_cast<double>(c) / static_cast<double>(u);
+}
+
+}       // namespace detail
+
+template<std::size_t K>
+class minhash
+{
+        static_assert(K > 0);
+
+        std::array<std::uint64_t, K> m_multipliers;
+        std::array<std::uint64_t, K> m_increments;
+
+public:
+        using signature_type = std::array<std::uint32_t, K>;
+
+        static constexpr auto size() noexcept { return K; }
+
+        explicit minhash(std::uint64_t seed = 0) noexcept
+        {
+                for (auto i : std::views::iota(0uz, K)) {
+                        m_multipliers[i] = bit::splitmix64(seed) | 1;
+                        m_increments[i] = bit::splitmix64(seed);
+                }
+        }
+
+        // The empty set has all signature values equal to the maximum.
+        template<std::size_t N, std::unsigned_integral Block>
+        [[nodiscard]] signature_type operator()(bit_set<N, Block> const& s) const noexcept
+        {
+                auto signature = signature_type();
+                signature.fill(std::numeric_limits<std::uint32_t>::max());
+                auto const bs = blocks(s);
+                for (auto b : std::views::iota(0uz, bs.size())) {
+                        for (auto block = bs[b]; block != 0; block &= static_cast<Block>(block - 1)) {
+                                auto const x = bit::mix(b * bit_set<N, Block>::bits_per_block + bit::countr_zero(block));
+                                for (auto i : std::views::iota(0uz, K)) {
+                                        signature[i] = std::min(signature[i], static_cast<std::uint32_t>((x * m_multipliers[i] + m_increments[i]) >> 32));
+                                }
+                        }
+                }
+                return signature;
+        }
+};
+
+// b-bit MinHash: only the lowest B bits of every signature value, packed
+// into 64-bit words, K * B / 64 of them.
+template<std::size_t B, std::size_t K>
+        requires (std::has_single_bit(B) and B <= 32 and K * B % 64 == 0)
+[[nodiscard]] constexpr auto pack(std::array<std::uint32_t, K> const& signature) noexcept
+{
+        auto packed = std::array<std::uint64_t, K * B / 64>();
+        for (auto i : std::views::iota(0uz, K)) {
+                auto const value = static_cast<std::uint64_t>(signature[i]) & ((std::uint64_t{1} << B) - 1);
+                packed[i * B / 64] |= value << (i * B % 64);
+        }
+        return packed;
+}
+
+// The number of agreeing B-bit values: the lanes of the XOR are ORed down
+// into their lowest bit, so that one popcount per word counts mismatches.
+template<std::size_t B, std::size_t W>
+        requires (std::has_single_bit(B) and B <= 32)
+[[nodiscard]] constexpr std::size_t matches(std::array<std::uint64_t, W> const& lhs, std::array<std::uint64_t, W> const& rhs) noexcept
+{
+        constexpr auto lowest = []() {
+                auto nrv = std::uint64_t{0};
+                for (auto i = 0uz; i < 64; i += B) {
+                        nrv |= std::uint64_t{1} << i;
+                }
+                return nrv;
+        }();
+        auto mismatches = 0uz;
+        for (auto w : std::views::iota(0uz, W)) {
+                auto x = lhs[w] ^ rhs[w];
+                for (auto shift = B / 2; shift > 0; shift /= 2) {
+                        x |= x >> shift;
+                }
+                mismatches += bit::popcount(x & lowest);
+        }
+        return W * 64 / B - mismatches;
+}
+
+// The Jaccard similarity estimated from b-bit signatures, correcting for
+// the 2^-B chance that unequal values agree in their lowest B bits.
+template<std::size_t B, std::size_t W>
+[[nodiscard]] double estimate(std::array<std::uint64_t, W> const& lhs, std::array<std::uint64_t, W> const& rhs) noexcept
+{
+        auto const chance = 1.0 / static_cast<double>(std::uint64_t{1} << B);
+        auto const agreement = static_cast<double>(matches<B>(lhs, rhs)) / static_cast<double>(W * 64 / B);
+        return std::clamp((agreement - chance) / (1.0 - chance), 0.0, 1.0);
+}
+
+// Banded LSH over MinHash signatures: the signature is cut into Bands bands
+// of Rows values, and two sets become candidates when they agree on all
+// values of at least one band, which happens with probability
+// 1 - (1 - J^Rows)^Bands for Jaccard similarity J. Every band is a sorted
+// array of (band hash, id) pairs, so that lookups are binary searches and
+// the buckets of a self-join are runs of equal hashes. All candidates are
+// then verified exactly.
+template<std::size_t N, std::size_t Bands, std::size_t Rows, std::unsigned_integral Block = std::size_t>
+class lsh_index
+{
+        static_assert(Bands > 0 and Rows > 0);
+
+public:
+        using set_type = bit_set<N, Block>;
+
+        struct match
+        {
+                std::size_t first;
+                std::size_t second;
+                double similarity;
+
+                // Through std::weak_order rather than ==, which -Wfloat-equal
+                // rejects: the similarities of equal pairs are computed identically.
+                [[nodiscard]] friend bool operator==(match const& lhs, match const& rhs) noexcept
+                {
+                        return lhs.first == rhs.first and lhs.second == rhs.second and std::is_eq(std::weak_order(lhs.similarity, rhs.similarity));
+                }
+        };
+
+private:
+        using minhash_type = minhash<Bands * Rows>;
+        using band_type = std::vector<std::pair<std::uint64_t, std::size_t>>;
+
+        minhash_type m_minhash;
+        std::vector<set_type> m_sets;
+        std::vector<std::size_t> m_counts;
+        std::array<band_type, Bands> m_bands;
+
+        [[nodiscard]] static std::uint64_t key(typename minhash_type::signature_type const& signature, std::size_t band) noexcept
+        {
+                auto h = std::uint64_t{band};
+                for (auto r : std::views::iota(0uz, Rows)) {
+                        h = bit::mix(h ^ signature[band * Rows + r]) + r;
+                }
+                return h;
+        }
+
+public:
+        template<std::ranges::input_range R>
+                requires std::same_as<std::ranges::range_value_t<R>, set_type>
+        explicit lsh_index(R const& sets, std::uint64_t seed = 0)
+        :
+                m_minhash(seed)
+        {
+                for (auto const& s : sets) {
+                        auto const signature = m_minhash(s);
+                        for (auto band : std::views::iota(0uz, Bands)) {
+                                m_bands[band].emplace_back(key(signature, band), m_sets.size());
+                        }
+                        m_sets.push_back(s);
+                        m_counts.push_back(s.size());
+                }
+                for (auto& band : m_bands) {
+                        std::ranges::sort(band);
+                }
+        }
+
+        [[nodiscard]] auto size() const noexcept { return m_sets.size(); }
+
+        // The ids sharing a band with q, in increasing order.
+        [[nodiscard]] std::vector<std::size_t> candidates(set_type const& q) const
+        {
+                auto ids = std::vector<std::size_t>();
+                auto const signature = m_minhash(q);
+                for (auto band : std::views::iota(0uz, Bands)) {
+                        for (auto const& [_, id] : std::ranges::equal_range(m_bands[band], key(signature, band), {}, &band_type::value_type::first)) {
+                                ids.push_back(id);
+                        }
+                }
+                std::ranges::sort(ids);
+                ids.erase(std::ranges::unique(ids).begin(), ids.end());
+                return ids;
+        }
+
+        // The (id, similarity) of the candidates with a Jaccard similarity
+        // to q of at least threshold, in increasing order of id.
+        [[nodiscard]] std::vector<std::pair<std::size_t, double>> query(set_type const& q, double threshold) const
+        {
+                auto result = std::vector<std::pair<std::size_t, double>>();
+                auto const count = q.size();
+                for (auto id : candidates(q)) {
+                        auto const j = detail::jaccard(count, m_counts[id], intersection_count(q, m_sets[id]));
+                        if (j >= threshold) {
+                                result.emplace_back(id, j);
+                        }
+                }
+                return result;
+        }
+
+        // All pairs of ids first < second sharing a band and with a Jaccard
+        // similarity of at least threshold, in lexicographic order.
+        [[nodiscard]] std::vector<match> self_join(double threshold) const
+        {
+                auto pairs = std::vector<std::pair<std::size_t, std::size_t>>();
+                for (auto const& band : m_bands) {
+                        for (auto first = band.begin(); first != band.end(); ) {
+                                auto const last = std::ranges::find_if(first, band.end(), [&](auto const& e) { return e.first != first->first; });
+                                for (auto i = first; i != last; ++i) {
+                                        for (auto j = std::next(i); j != last; ++j) {
+                                                pairs.emplace_back(i->second, j->second);
+                                        }
+                                }
+                                first = last;
+                        }
+                }
+                std::ranges::sort(pairs);
+                pairs.erase(std::ranges::unique(pairs).begin(), pairs.end());
+
+                auto result = std::vector<match>();
+                for (auto [first, second] : pairs) {
+                        auto const j = detail::jaccard(m_counts[first], m_counts[second], intersection_count(m_sets[first], m_sets[second]));
+                        if (j >= threshold) {
+                                result.push_back({ first, second, j });
+                        }
+                }
+                return result;
+        }
+};
+
+}       // namespace xstd
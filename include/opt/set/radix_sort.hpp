@@ -0,0 +1,247 @@
+#pragma once
+
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit/intrin.hpp>  // reverse
+#include <xstd/bit_set.hpp>     // bit_set
+#include <algorithm>            // clamp, copy, find, sort, unique
+#include <array>                // array
+#include <bit>                  // bit_width
+#include <compare>              // operator<=>
+#include <concepts>             // unsigned_integral
+#include <cstddef>              // size_t
+#include <cstdint>              // uint64_t
+#include <ranges>               // iota
+#include <span>                 // span
+#include <thread>               // jthread
+#include <vector>               // vector
+
+// Radix sorting and deduplication of bit_sets, in the order of operator<=>.
+//
+// bit_set compares as the lexicographic order of its element sequences: at
+// the lowest element d in which x and y differ, the set containing d is the
+// smaller one, unless the other set has no elements above d, in which case
+// it is a proper prefix and the smaller one. Every set x therefore gets the
+// key
+//
+//      key(x)[i] = not x[i] for i < top(x) = max(x) + 1, and 0 from there on
+//
+// compared bit by bit from element 0 upward. Ties between different sets only
+// occur between a set and its extensions by a run of consecutive elements
+// above its maximum, and are broken by top. The sort is a most significant
+// digit radix sort on the bytes of (key, top), which skips the bytes on
+// which all sets of a bucket agree, and which sorts buckets of up to 256 sets
+// by comparison of their (key, top).
+//
+// With multiple threads, the sets are first partitioned on their most
+// significant varying byte, and the 256 partitions are then sorted
+// independently, partition p by thread p % T.
+
+namespace xstd {
+namespace radix_sort_detail {
+
+template<std::size_t N, std::unsigned_integral Block>
+class sorter
+{
+        using set_type = bit_set<N, Block>;
+
+        static constexpr auto bits_per_block = set_type::bits_per_block;
+        static constexpr auto num_blocks     = set_type::num_blocks;
+        static constexpr auto key_words      = (N + 63) / 64;
+        static constexpr auto key_digits     = (N + 7) / 8;
+        static constexpr auto top_digits     = (static_cast<std::size_t>(std::bit_width(N)) + 7) / 8;
+        static constexpr auto num_digits     = key_digits + top_digits;
+        static constexpr auto small          = 256uz;
+
+        // The key in 64-bit words, with element 0 in the highest bit of word
+        // 0, ordered as (key, top), from which the set can be recovered.
+        struct record
+        {
+                std::array<std::uint64_t, key_words> key;
+                std::size_t top;
+
+                [[nodiscard]] auto operator<=>(record const&) const = default;
+        };
+
+        using histogram = std::array<std::size_t, 256>;
+
+        // The bits of word w below top.
+        [[nodiscard]] static std::uint64_t mask(std::size_t top, std::size_t w) noexcept
+        {
+                auto const n = std::clamp(top, w * 64, w * 64 + 64) - w * 64;
+                return n == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << n) - 1;
+        }
+
+        // The elements 64 w, ..., 64 w + 63 of s.
+        [[nodiscard]] static std::uint64_t word(set_type const& s, std::size_t w) noexcept
+        {
+                auto const bs = blocks(s);
+                if constexpr (bits_per_block >= 64) {
+                        return static_cast<std::uint64_t>(bs[w * 64 / bits_per_block] >> (w * 64 % bits_per_block));
+                } else {
+                        auto nrv = std::uint64_t{0};
+                        for (auto k = 0uz, b = w * 64 / bits_per_block; k < 64 / bits_per_block and b < num_blocks; ++k, ++b) {
+                                nrv |= static_cast<std::uint64_t>(bs[b]) << (k * bits_per_block);
+                        }
+                        return nrv;
+                }
+        }
+
+        [[nodiscard]] static record encode(set_type const& s) noexcept
+        {
+                auto const bs = blocks(s);
+                auto nrv = record{ {}, 0 };
+                for (auto b = bs.size(); b-- > 0; ) {
+                        if (bs[b] != 0) {
+                                nrv.top = b * bits_per_block + static_cast<std::size_t>(std::bit_width(bs[b]));
+                                break;
+                        }
+                }
+                for (auto w : std::views::iota(0uz, key_words)) {
+                        nrv.key[w] = bit::reverse(~word(s, w) & mask(nrv.top, w));
+                }
+                return nrv;
+        }
+
+        [[nodiscard]] static set_type decode(record const& r) noexcept
+        {
+                auto nrv = set_type();
+                auto const bs = blocks(nrv);
+                for (auto w : std::views::iota(0uz, key_words)) {
+                        auto const x = bit::reverse(~r.key[w]) & mask(r.top, w);
+                        if constexpr (bits_per_block >= 64) {
+                                auto const b = w * 64 / bits_per_block;
+                                set_block(nrv, b, static_cast<Block>(bs[b] | static_cast<Block>(static_cast<Block>(x) << (w * 64 % bits_per_block))));
+                        } else {
+                                for (auto k = 0uz, b = w * 64 / bits_per_block; k < 64 / bits_per_block and b < num_blocks; ++k, ++b) {
+                                        set_block(nrv, b, static_cast<Block>(x >> (k * bits_per_block)));
+                                }
+                        }
+                }
+                return nrv;
+        }
+
+        // Digit d of (key, top), with digit 0 the most significant.
+        [[nodiscard]] static std::size_t digit(record const& r, std::size_t d) noexcept
+        {
+                return d < key_digits ? r.key[d / 8] >> (56 - d % 8 * 8) & 0xFF : r.top >> (8 * (num_digits - 1 - d)) & 0xFF;
+        }
+
+        [[nodiscard]] static histogram count(std::span<record const> records, std::size_t d) noexcept
+        {
+                auto nrv = histogram();
+                for (auto const& r : records) {
+                        ++nrv[digit(r, d)];
+                }
+                return nrv;
+        }
+
+        [[nodiscard]] static bool constant(histogram const& count, std::size_t n) noexcept
+        {
+                return std::ranges::find(count, n) != count.end();
+        }
+
+        [[nodiscard]] static histogram offsets(histogram const& count) noexcept
+        {
+                auto nrv = histogram();
+                for (auto sum = 0uz; auto i : std::views::iota(0uz, count.size())) {
+                        nrv[i] = sum;
+                        sum += count[i];
+                }
+                return nrv;
+        }
+
+        // Sorts src on the digits d, d + 1, ..., the digits before d being
+        // equal for all records, into src if in_place, and into dst
+        // otherwise. Small ranges are sorted by comparison.
+        static void msd(std::span<record> src, std::span<record> dst, std::size_t d, bool in_place)
+        {
+                auto n = histogram();
+                while (src.size() > small and d < num_digits and constant(n = count(src, d), src.size())) {
+                        ++d;
+                }
+                if (src.size() <= small or d == num_digits) {
+                        std::ranges::sort(src);
+                        if (not in_place) {
+                                std::ranges::copy(src, dst.begin());
+                        }
+                        return;
+                }
+                auto const first = offsets(n);
+                auto offset = first;
+                for (auto const& r : src) {
+                        dst[offset[digit(r, d)]++] = r;
+                }
+                for (auto p : std::views::iota(0uz, first.size())) {
+                        msd(dst.subspan(first[p], n[p]), src.subspan(first[p], n[p]), d + 1, not in_place);
+                }
+        }
+
+public:
+        static void sort(std::vector<set_type>& sets, std::size_t num_threads)
+        {
+                auto records = std::vector<record>();
+                records.reserve(sets.size());
+                for (auto const& s : sets) {
+                        records.push_back(encode(s));
+                }
+                auto buffer = std::vector<record>(records.size());
+
+                if (num_threads = std::clamp(num_threads, 1uz, 256uz); num_threads == 1) {
+                        msd(records, buffer, 0, true);
+                } else {
+                        auto d = 0uz;
+                        auto n = histogram();
+                        while (d < num_digits and constant(n = count(records, d), records.size())) {
+                                ++d;
+                        }
+                        if (d == num_digits) {
+                                return;
+                        }
+                        auto const first = offsets(n);
+                        auto offset = first;
+                        for (auto const& r : records) {
+                                buffer[offset[digit(r, d)]++] = r;
+                        }
+                        auto const sort_partitions = [&](std::size_t t) {
+                                for (auto p = t; p < first.size(); p += num_threads) {
+                                        msd(std::span(buffer).subspan(first[p], n[p]), std::span(records).subspan(first[p], n[p]), d + 1, false);
+                                }
+                        };
+                        auto workers = std::vector<std::jthread>();
+                        for (auto t : std::views::iota(1uz, num_threads)) {
+                                workers.emplace_back(sort_partitions, t);
+                        }
+                        sort_partitions(0);
+                }
+                for (auto i : std::views::iota(0uz, sets.size())) {
+                        sets[i] = decode(records[i]);
+                }
+        }
+};
+
+}       // namespace radix_sort_detail
+
+// Sorts sets in the order of operator<=>.
+template<std::size_t N, std::unsigned_integral Block>
+void sort_bit_sets(std::vector<bit_set<N, Block>>& sets, std::size_t num_threads = 1)
+{
+        radix_sort_detail::sorter<N, Block>::sort(sets, num_threads);
+}
+
+// Sorts sets in the order of operator<=> and removes the duplicates, and
+// returns the number of removed sets.
+template<std::size_t N, std::unsigned_integral Block>
+std::size_t unique_bit_sets(std::vector<bit_set<N, Block>>& sets, std::size_t num_threads = 1)
+{
+        sort_bit_sets(sets, num_threads);
+        auto const [first, last] = std::ranges::unique(sets);
+        auto const removed = static_cast<std::size_t>(last - first);
+        sets.erase(first, last);
+        return removed;
+}
+
+}       // namespace xstd
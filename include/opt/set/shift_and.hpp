@@ -0,0 +1,116 @@
+#pragma once
+
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit_set.hpp>     // bit_set
+#include <array>                // array
+#include <concepts>             // unsigned_integral
+#include <cstddef>              // size_t
+#include <initializer_list>     // initializer_list
+#include <ranges>               // input_range
+                                // iota
+#include <span>                 // span
+#include <stdexcept>            // invalid_argument, length_error
+#include <string_view>          // string_view
+#include <utility>              // pair
+#include <vector>               // vector
+
+// Multi-pattern Shift-And (Baeza-Yates and Gonnet): the patterns are packed
+// back to back into the elements [0, N) of one bit_set, element i standing
+// for "the text read so far ends with the first i - start + 1 characters of
+// the pattern starting at start". Every text character c advances all of
+// them at once: state = ((state << 1) | first) & masks[c]. The bit that the
+// shift carries from the end of one pattern into the start of the next is
+// always set again by | first, so the patterns never interfere.
+
+namespace xstd {
+
+template<std::size_t N, std::unsigned_integral Block = std::size_t>
+class shift_and_matcher
+{
+        using set_type = bit_set<N, Block>;
+
+        std::vector<std::size_t> m_pattern;     // the pattern ending at every element
+        std::size_t m_position{};
+        std::array<set_type, 256> m_masks{};    // the elements holding character c
+        set_type m_first{};                     // the first element of every pattern
+        set_type m_last{};                      // the last element of every pattern
+        set_type m_state{};
+
+public:
+        explicit shift_and_matcher(std::initializer_list<std::string_view> patterns)
+        :
+                shift_and_matcher(std::span(patterns.begin(), patterns.size()))
+        {}
+
+        template<std::ranges::input_range R>
+        explicit shift_and_matcher(R const& patterns)
+        :
+                m_pattern(N)
+        {
+                auto start = 0uz;
+                auto p = 0uz;
+                for (std::string_view pattern : patterns) {
+                        if (pattern.empty()) {
+                                throw std::invalid_argument("shift_and_matcher: empty pattern");
+                        }
+                        if (pattern.size() > N - start) {
+                                throw std::length_error("shift_and_matcher: patterns exceed N characters");
+                        }
+                        for (auto i : std::views::iota(0uz, pattern.size())) {
+                                m_masks[static_cast<unsigned char>(pattern[i])].insert(start + i);
+                        }
+                        m_first.insert(start);
+                        start += pattern.size();
+                        m_last.insert(start - 1);
+                        m_pattern[start - 1] = p++;
+                }
+        }
+
+        // The number of characters fed so far.
+        [[nodiscard]] auto position() const noexcept { return m_position; }
+
+        void reset() noexcept
+        {
+                m_state.clear();
+                m_position = 0;
+        }
+
+        // Scans the next chunk of a text stream, so that matches may straddle
+        // chunks, and calls fun(end, p) for every occurrence of pattern p
+        // ending just before stream position end.
+        void feed(std::span<char const> text, auto fun)
+        {
+                for (auto c : text) {
+                        if constexpr (N > 1) {
+                                m_state <<= 1;
+                        } else {
+                                m_state.clear();        // bit_set<1> can't be shifted by 1
+                        }
+                        m_state |= m_first;
+                        m_state &= m_masks[static_cast<unsigned char>(c)];
+                        ++m_position;
+                        if (m_state.intersects(m_last)) [[unlikely]] {
+                                auto const hits = m_state & m_last;
+                                for (auto n = find_first(hits); n != N; n = find_next(hits, n)) {
+                                        fun(m_position, m_pattern[n]);
+                                }
+                        }
+                }
+        }
+
+        // All (end, p) pairs of the next chunk, in order of end position.
+        [[nodiscard]] auto feed(std::span<char const> text)
+        {
+                auto matches = std::vector<std::pair<std::size_t, std::size_t>>();
+                feed(text, [&](auto end, auto p) {
+                        matches.emplace_back(end, p);
+                });
+                return matches;
+        }
+};
+
+}       // namespace xstd
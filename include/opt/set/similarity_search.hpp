@@ -0,0 +1,183 @@
+#pragma once
+
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <opt/set/intersection_count.hpp>  // intersection_count
+#include <xstd/bit_set.hpp>                // bit_set
+#include <algorithm>                       // max, min, pop_heap, push_heap, sort
+#include <compare>                         // is_eq, is_gt, weak_order
+#include <concepts>                        // same_as, unsigned_integral
+#include <cstddef>                         // size_t
+#include <ranges>                          // input_range, range_value_t
+                                           // iota
+#include <thread>                          // jthread
+#include <utility>                         // move
+#include <vector>                          // vector
+
+// Exact top-k similarity search over a store of fingerprints, e.g. the
+// 1024 or 2048 bit chemical fingerprints of a compound library.
+//
+// All metrics follow from the cardinalities |a| and |b| and the intersection
+// count c = |a & b|: Tanimoto (Jaccard) c / (|a| + |b| - c), and Hamming
+// similarity 1 - d / N with distance d = |a| + |b| - 2c. The cardinalities
+// are computed once, so that scoring a candidate is a single fused popcount
+// of the ANDed blocks. The store is sorted by cardinality, and a query scans
+// it outward from |q|: the cardinalities alone bound the score from above,
+// by min(|q|, |b|) / max(|q|, |b|) and 1 - ||q| - |b|| / N, and both bounds
+// fall monotonically away from |q|, so the scan stops in either direction as
+// soon as the bound drops below the k-th best score found so far (Swamidass
+// and Baldi).
+//
+// With multiple threads, thread t scans the elements t, t + T, t + 2T, ...
+// of the store, which are sorted by cardinality too, so that every thread
+// sees the same cardinality distribution and prunes equally well. The
+// per-thread top-k are merged at the end.
+
+namespace xstd {
+
+enum class similarity { tanimoto, jaccard = tanimoto, hamming };
+
+template<std::size_t N, std::unsigned_integral Block = std::size_t>
+class similarity_index
+{
+public:
+        using set_type = bit_set<N, Block>;
+
+        struct hit
+        {
+                std::size_t id;         // the position of the fingerprint in the original range
+                double score;
+
+                // Through std::weak_order rather than ==, which -Wfloat-equal
+                // rejects: the scores of equal hits are computed identically.
+                [[nodiscard]] friend bool operator==(hit const& lhs, hit const& rhs) noexcept
+                {
+                        return lhs.id == rhs.id and std::is_eq(std::weak_order(lhs.score, rhs.score));
+                }
+        };
+
+private:
+        std::vector<set_type> m_sets;           // sorted by cardinality
+        std::vector<std::size_t> m_ids;
+        std::vector<std::size_t> m_offsets;     // the number of elements with a cardinality below c, for c in [0, N + 1]
+
+        // Higher scores first, ties broken by lower ids, which makes the
+        // result unique.
+        [[nodiscard]] static bool better(hit const& lhs, hit const& rhs) noexcept
+        {
+                auto const cmp = std::weak_order(lhs.score, rhs.score);
+                return std::is_gt(cmp) or (std::is_eq(cmp) and lhs.id < rhs.id);
+        }
+
+        [[nodiscard]] static double score(similarity metric, std::size_t a, std::size_t b, std::size_t c) noexcept
+        {
+                if (metric == similarity::hamming) {
+                        return 1.0 - static_cast<double>(a + b - 2 * c) / static_cast<double>(N);
+                }
+                auto const u = a + b - c;
+                return u == 0 ? 1.0 : static_cast<double>(c) / static_cast<double>(u);
+        }
+
+        // The score with the largest possible intersection count.
+        [[nodiscard]] static double bound(similarity metric, std::size_t a, std::size_t b) noexcept
+        {
+                return score(metric, a, b, std::min(a, b));
+        }
+
+public:
+        template<std::ranges::input_range R>
+                requires std::same_as<std::ranges::range_value_t<R>, set_type>
+        explicit similarity_index(R const& sets)
+        {
+                auto unsorted = std::vector<set_type>();
+                for (auto const& s : sets) {
+                        unsorted.push_back(s);
+                        m_ids.push_back(m_ids.size());
+                }
+                std::ranges::sort(m_ids, {}, [&](auto id) { return unsorted[id].size(); });
+                m_offsets.assign(N + 2, 0);
+                for (auto id : m_ids) {
+                        m_sets.push_back(unsorted[id]);
+                        ++m_offsets[unsorted[id].size() + 1];
+                }
+                for (auto c : std::views::iota(1uz, N + 2)) {
+                        m_offsets[c] += m_offsets[c - 1];
+                }
+        }
+
+        [[nodiscard]] auto size() const noexcept { return m_sets.size(); }
+
+        // The k most similar fingerprints to the query, best first.
+        [[nodiscard]] std::vector<hit> top_k(set_type const& query, std::size_t k, similarity metric = similarity::tanimoto, std::size_t num_threads = 1) const
+        {
+                num_threads = std::max(1uz, std::min(num_threads, size()));
+                auto partial = std::vector<std::vector<hit>>(num_threads);
+                {
+                        auto workers = std::vector<std::jthread>();
+                        for (auto t : std::views::iota(1uz, num_threads)) {
+                                workers.emplace_back([&, t]() {
+                                        partial[t] = scan(query, k, metric, t, num_threads);
+                                });
+                        }
+                        partial[0] = scan(query, k, metric, 0, num_threads);
+                }
+                auto result = std::move(partial[0]);
+                for (auto t : std::views::iota(1uz, num_threads)) {
+                        result.insert(result.end(), partial[t].begin(), partial[t].end());
+                }
+                std::ranges::sort(result, better);
+                if (result.size() > k) {
+                        result.resize(k);
+                }
+                return result;
+        }
+
+private:
+        // The top-k among the elements first, first + stride, ... of the
+        // store, unordered.
+        [[nodiscard]] std::vector<hit> scan(set_type const& query, std::size_t k, similarity metric, std::size_t first, std::size_t stride) const
+        {
+                auto heap = std::vector<hit>();         // the worst hit on top
+                if (k == 0) {
+                        return heap;
+                }
+                auto const q = query.size();
+
+                // The first element of this scan with a cardinality of at least c.
+                auto const level = [&](std::size_t c) {
+                        auto const i = m_offsets[c];
+                        return i <= first ? first : first + (i - first + stride - 1) / stride * stride;
+                };
+
+                // Whole cardinality levels, each with a single bound, so that
+                // the inner loop over a level has no data-dependent branches
+                // besides the heap update.
+                auto left = q;
+                auto right = q;
+                while (left > 0 or right <= N) {
+                        auto const left_bound  = left  > 0  ? bound(metric, q, left - 1) : -1.0;
+                        auto const right_bound = right <= N ? bound(metric, q, right)    : -1.0;
+                        if (heap.size() == k and std::max(left_bound, right_bound) < heap.front().score) {
+                                break;
+                        }
+                        auto const c = left_bound > right_bound ? --left : right++;
+                        for (auto i = level(c), last = m_offsets[c + 1]; i < last; i += stride) {
+                                auto const h = hit{ m_ids[i], score(metric, q, c, intersection_count(query, m_sets[i])) };
+                                if (heap.size() < k) {
+                                        heap.push_back(h);
+                                        std::ranges::push_heap(heap, better);
+                                } else if (better(h, heap.front())) {
+                                        std::ranges::pop_heap(heap, better);
+                                        heap.back() = h;
+                                        std::ranges::push_heap(heap, better);
+                                }
+                        }
+                }
+                return heap;
+        }
+};
+
+}       // namespace xstd
@@ -0,0 +1,138 @@
+#ifndef XSTD_ATOMIC_BIT_SET_HPP
+#define XSTD_ATOMIC_BIT_SET_HPP
+
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit/intrin.hpp>  // countr_zero
+#include <xstd/bit_set.hpp>     // bit_set
+#include <array>                // array
+#include <atomic>               // atomic, memory_order
+#include <cassert>              // assert
+#include <concepts>             // unsigned_integral
+#include <cstddef>              // size_t
+#include <ranges>               // iota
+
+namespace xstd {
+
+// A bit_set<N, Block> that can be read and modified by several threads at
+// once without a lock. Its blocks are std::atomic<Block>, so that inserting
+// or erasing one element is a single fetch_or or fetch_and on its block,
+// which also tells whether the element was present before. That is what
+// makes insert a claim: of several threads inserting the same element,
+// exactly one sees it inserted. Every single-element operation takes the
+// memory order of the underlying atomic operation, defaulting to
+// std::memory_order_seq_cst as for std::atomic. The whole-set operations
+// (snapshot, find_first, clear) load or store the blocks one at a time,
+// and are therefore not atomic as a whole when there are concurrent
+// writers: every block is read or written atomically, but different blocks
+// at different moments.
+template<std::size_t N, std::unsigned_integral Block = std::size_t>
+class atomic_bit_set
+{
+        static_assert(std::atomic<Block>::is_always_lock_free);
+
+public:
+        using set_type   = bit_set<N, Block>;
+        using value_type = std::size_t;
+        using size_type  = std::size_t;
+
+private:
+        static constexpr auto bits_per_block = set_type::bits_per_block;
+        static constexpr auto num_blocks     = set_type::num_blocks;
+
+        std::array<std::atomic<Block>, num_blocks> m_blocks{};
+
+        [[nodiscard]] static constexpr Block mask(value_type x) noexcept
+        {
+                return static_cast<Block>(Block{1} << (x % bits_per_block));
+        }
+
+        [[nodiscard]] std::atomic<Block>& block(value_type x) noexcept
+        {
+                assert(x < N);
+                return m_blocks[x / bits_per_block];
+        }
+
+        [[nodiscard]] std::atomic<Block> const& block(value_type x) const noexcept
+        {
+                assert(x < N);
+                return m_blocks[x / bits_per_block];
+        }
+
+public:
+        atomic_bit_set() noexcept = default;
+
+        // Not thread-safe: s is stored before the set is shared.
+        explicit atomic_bit_set(set_type const& s) noexcept
+        {
+                for (auto const src = blocks(s); auto b : std::views::iota(0uz, num_blocks)) {
+                        m_blocks[b].store(src[b], std::memory_order_relaxed);
+                }
+        }
+
+        [[nodiscard]] bool contains(value_type x, std::memory_order order = std::memory_order_seq_cst) const noexcept
+        {
+                return (block(x).load(order) & mask(x)) != 0;
+        }
+
+        // Inserts x, and returns whether x was present before.
+        bool test_and_set(value_type x, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+                return (block(x).fetch_or(mask(x), order) & mask(x)) != 0;
+        }
+
+        // Erases x, and returns whether x was present before.
+        bool test_and_reset(value_type x, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+                return (block(x).fetch_and(static_cast<Block>(~mask(x)), order) & mask(x)) != 0;
+        }
+
+        // Whether x was inserted by this call.
+        bool insert(value_type x, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+                return not test_and_set(x, order);
+        }
+
+        // The number of elements erased by this call.
+        size_type erase(value_type x, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+                return test_and_reset(x, order);
+        }
+
+        void clear(std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+                for (auto& b : m_blocks) {
+                        b.store(Block{0}, order);
+                }
+        }
+
+        // A copy of the set, loaded one block at a time.
+        [[nodiscard]] set_type snapshot(std::memory_order order = std::memory_order_relaxed) const noexcept
+        {
+                auto nrv = set_type();
+                for (auto b : std::views::iota(0uz, num_blocks)) {
+                        set_block(nrv, b, m_blocks[b].load(order));
+                }
+                return nrv;
+        }
+
+        // The first element present in its block when that block was
+        // loaded, or N if there was none. Only the blocks up to the one
+        // holding that element are loaded.
+        [[nodiscard]] friend size_type find_first(atomic_bit_set const& c, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+                for (auto b : std::views::iota(0uz, num_blocks)) {
+                        if (auto const bits = c.m_blocks[b].load(order); bits != 0) {
+                                return b * bits_per_block + bit::countr_zero(bits);
+                        }
+                }
+                return N;
+        }
+};
+
+}       // namespace xstd
+
+#endif  // include guard
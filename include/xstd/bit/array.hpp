@@ -6,13 +6,15 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          http://www.boost.org/LICENSE_1_0.txt)
 
-#include <xstd/bit/intrin.hpp>                  // countl_zero, countr_zero, popcount
+#include <xstd/bit/intrin.hpp>                  // addc, byteswap, countl_zero, countr_zero, pdep, pext, popcount, reverse, subb
 #include <xstd/bit/pred.hpp>                    // intersects, is_subset_of, not_equal_to
 #include <xstd/utility.hpp>                     // aligned_size
 #include <boost/hash2/hash_append_fwd.hpp>      // hash_append, hash_append_tag
-#include <algorithm>                            // all_of, any_of, copy, fill_n, find_if, fold_left, max, shift_left, shift_right
+#include <algorithm>                            // all_of, any_of, copy, fill_n, find_if, fold_left, max, reverse, shift_left, shift_right, transform
 #include <array>                                // array
+#include <bit>                                  // rotl
 #include <cassert>                              // assert
+#include <compare>                               // strong_ordering
 #include <concepts>                             // unsigned_integral
 #include <cstddef>                              // ptrdiff_t, size_t
 #include <functional>                           // plus
@@ -53,8 +55,9 @@ struct array
         // compare<Bits> comments), so array can't offer one without silently
         // picking a side; == is unaffected because equality of the
         // underlying bits is the same relation under either interpretation.
-        // bit_set, bitset, and bit_array each provide their own <=> in terms
-        // of their own iteration instead.
+        // Both relations are available by name instead, word-parallel, as
+        // set_three_way and sequence_three_way below, for bit_set/bitset
+        // and bit_array to build their own <=> on.
 
         template<class Provider, class Hash, class Flavor>
         friend constexpr void tag_invoke(boost::hash2::hash_append_tag const&, Provider const&, Hash& h, Flavor const& f, array const* v) noexcept
@@ -284,7 +287,151 @@ struct array
                         std::ranges::fill_n(std::ranges::prev(m_bits.end(), static_cast<std::ptrdiff_t>(n_blocks)), static_cast<std::ptrdiff_t>(n_blocks), zero);
                 }
         }
-        
+
+        // Rotations modulo N: rotl(n) moves bit i to bit (i + n) mod N. For
+        // whole blocks (N a multiple of bits_per_block), every block is a
+        // single funnel shift of two source blocks; otherwise the bits
+        // wrapping around the unused tail are ORed in by a second shift.
+        constexpr void rotl(std::size_t n [[maybe_unused]]) noexcept
+        {
+                if constexpr (N > 0) {
+                        n %= N;
+                        if (n == 0) {
+                                return;
+                        }
+                        if constexpr (num_blocks == 1 and not has_unused_bits) {
+                                m_bits[0] = std::rotl(m_bits[0], static_cast<int>(n));
+                        } else if constexpr (num_blocks == 1) {
+                                m_bits[0] = static_cast<Block>(static_cast<Block>(m_bits[0] << n) | static_cast<Block>(m_bits[0] >> (N - n))) & used_bits;
+                        } else if constexpr (has_unused_bits) {
+                                auto wrap = *this;
+                                wrap >>= N - n;
+                                *this <<= n;
+                                *this |= wrap;
+                        } else {
+                                auto const [ n_blocks, L_shift ] = div_mod(n, bits_per_block);
+                                auto const src = m_bits;
+                                for (auto i : std::views::iota(0uz, num_blocks)) {
+                                        auto const hi = src[(i + num_blocks - n_blocks) % num_blocks];
+                                        if (L_shift == 0) {
+                                                m_bits[i] = hi;
+                                        } else {
+                                                auto const lo = src[(i + 2 * num_blocks - n_blocks - 1) % num_blocks];
+                                                m_bits[i] = static_cast<Block>(hi << L_shift) | static_cast<Block>(lo >> (bits_per_block - L_shift));
+                                        }
+                                }
+                        }
+                }
+        }
+
+        constexpr void rotr(std::size_t n [[maybe_unused]]) noexcept
+        {
+                if constexpr (N > 0) {
+                        rotl(N - n % N);
+                }
+        }
+
+        // Mirrors bit i to bit N - 1 - i: reverses the order of the blocks
+        // and the bits within each block, which leaves the zero unused
+        // bits at the bottom, to be shifted out again.
+        constexpr void reverse() noexcept
+        {
+                if constexpr (num_blocks == 1 and N > 0) {
+                        m_bits[0] = static_cast<Block>(bit::reverse(m_bits[0]) >> num_unused_bits);
+                } else if constexpr (num_blocks >= 2) {
+                        std::ranges::reverse(m_bits);
+                        std::ranges::transform(m_bits, m_bits.begin(), [](auto block) { return bit::reverse(block); });
+                        if constexpr (has_unused_bits) {
+                                *this >>= num_unused_bits;
+                        }
+                }
+        }
+
+        // Mirrors byte i to byte N / 8 - 1 - i, e.g. the ranks of a chess
+        // board in a single 64-bit block.
+        constexpr void byteswap() noexcept
+                requires (N % 8 == 0)
+        {
+                if constexpr (num_blocks == 1 and N > 0) {
+                        m_bits[0] = static_cast<Block>(bit::byteswap(m_bits[0]) >> num_unused_bits);
+                } else if constexpr (num_blocks >= 2) {
+                        std::ranges::reverse(m_bits);
+                        std::ranges::transform(m_bits, m_bits.begin(), [](auto block) { return bit::byteswap(block); });
+                        if constexpr (has_unused_bits) {
+                                *this >>= num_unused_bits;
+                        }
+                }
+        }
+
+        // Arithmetic modulo 2^N on the bits as an unsigned number, with the
+        // lowest block the least significant, chained through the carry (or
+        // borrow) of add-with-carry (subtract-with-borrow) on every block. A
+        // carry out of bit N - 1 lands in the unused bits, if any, from
+        // where it is returned and erased.
+        constexpr bool add(array const& other) noexcept
+        {
+                auto carry = false;
+                for (auto i : std::views::iota(0uz, num_blocks)) {
+                        m_bits[i] = bit::addc(m_bits[i], other.m_bits[i], carry);
+                }
+                if constexpr (has_unused_bits) {
+                        carry = bit::intersects(m_bits[last_block], unused_bits);
+                        erase_unused();
+                }
+                return carry;
+        }
+
+        constexpr bool sub(array const& other) noexcept
+        {
+                auto borrow = false;
+                for (auto i : std::views::iota(0uz, num_blocks)) {
+                        m_bits[i] = bit::subb(m_bits[i], other.m_bits[i], borrow);
+                }
+                erase_unused();
+                return borrow;
+        }
+
+        // Adds one, stopping at the first block that does not overflow.
+        constexpr bool increment() noexcept
+        {
+                if constexpr (N == 0) {
+                        return true;
+                }
+                for (auto i : std::views::iota(0uz, num_blocks)) {
+                        if (++m_bits[i] != zero) {
+                                if constexpr (has_unused_bits) {
+                                        if (i == last_block and bit::intersects(m_bits[last_block], unused_bits)) {
+                                                erase_unused();
+                                                return true;
+                                        }
+                                }
+                                return false;
+                        }
+                }
+                return true;
+        }
+
+        constexpr bool decrement() noexcept
+        {
+                if constexpr (N == 0) {
+                        return true;
+                }
+                for (auto i : std::views::iota(0uz, num_blocks)) {
+                        if (m_bits[i]-- != zero) {
+                                return false;
+                        }
+                }
+                erase_unused();
+                return true;
+        }
+
+        // The two's complement -x = ~x + 1.
+        constexpr void negate() noexcept
+        {
+                flip();
+                increment();
+        }
+
         constexpr void set() noexcept
         {
                 if constexpr (has_unused_bits) {
@@ -369,6 +516,71 @@ struct array
                 block ^= mask;
         }
 
+        // Gosper's hack: the lowest run of 1-bits ripples its top bit one
+        // position up (a carry that may propagate across blocks), and the
+        // rest of the run drops back to the lowest positions. Like
+        // std::next_permutation, wraps around to the first combination
+        // (and returns false) after the last one.
+        [[nodiscard]] constexpr bool next_combination() noexcept
+        {
+                if constexpr (N == 0) {
+                        return false;
+                } else if constexpr (num_blocks == 1) {
+                        auto const block = m_bits[0];
+                        if (block == zero) {
+                                return false;
+                        }
+                        auto const ripple = static_cast<Block>(block + static_cast<Block>(block & static_cast<Block>(-block)));
+                        if (ripple == zero or bit::intersects(ripple, unused_bits)) {
+                                m_bits[0] = zero;
+                                fill_front(bit::popcount(block));
+                                return false;
+                        }
+                        m_bits[0] = static_cast<Block>(ripple | static_cast<Block>(static_cast<Block>((ripple ^ block) >> 2) >> bit::countr_zero(block)));
+                        return true;
+                } else if constexpr (num_blocks >= 2) {
+                        if (none()) {
+                                return false;
+                        }
+                        auto [ index, offset ] = index_offset(find_first());
+                        auto carry = static_cast<Block>(unit << offset);
+                        auto changed = 0uz;
+                        for (; index < num_blocks and carry != zero; ++index) {
+                                auto const sum = static_cast<Block>(m_bits[index] + carry);
+                                changed += bit::popcount(static_cast<Block>(sum ^ m_bits[index]));
+                                carry = sum < carry ? unit : zero;
+                                m_bits[index] = sum;
+                        }
+                        if (carry != zero or bit::intersects(m_bits[last_block], unused_bits)) {
+                                reset();
+                                fill_front(carry != zero ? changed : changed - 1);
+                                return false;
+                        }
+                        fill_front(changed - 2);
+                        return true;
+                }
+        }
+
+        // (*this - 1) & mask, with the borrow propagated across blocks;
+        // wraps around from the empty set to mask itself (and returns false).
+        [[nodiscard]] constexpr bool prev_submask(array const& mask [[maybe_unused]]) noexcept
+        {
+                if constexpr (N > 0 and num_blocks == 1) {
+                        auto const borrow = m_bits[0] == zero;
+                        m_bits[0] = static_cast<Block>(m_bits[0] - unit) & mask.m_bits[0];
+                        return not borrow;
+                } else if constexpr (num_blocks >= 2) {
+                        for (auto i : std::views::iota(0uz, num_blocks)) {
+                                auto const borrow = m_bits[i] == zero;
+                                m_bits[i] = static_cast<Block>(m_bits[i] - unit) & mask.m_bits[i];
+                                if (not borrow) {
+                                        return true;
+                                }
+                        }
+                }
+                return false;
+        }
+
         [[nodiscard]] constexpr bool operator[](std::size_t n) const noexcept
         {
                 assert(is_valid(n));
@@ -516,6 +728,99 @@ struct array
                 }
         }
 
+        // The two orders of the bits as a sequence with index 0 first (see
+        // the comment on the missing operator<=> above), both decided at
+        // the lowest index n in which *this and other differ, found one
+        // block at a time by XOR. As a sequence of bools, the array with
+        // bit n cleared is the smaller one. As the ascending sequence of
+        // the indices of its set bits, the array with bit n set is the
+        // smaller one, unless the other array has no bits set above n, in
+        // which case that one is a proper prefix and the smaller one.
+        [[nodiscard]] constexpr std::strong_ordering sequence_three_way(array const& other [[maybe_unused]]) const noexcept
+        {
+                if constexpr (N > 0) {
+                        for (auto i : std::views::iota(0uz, num_blocks)) {
+                                if (auto const diff = static_cast<Block>(this->m_bits[i] ^ other.m_bits[i]); diff != zero) {
+                                        return bit::intersects(this->m_bits[i], static_cast<Block>(unit << bit::countr_zero(diff))) ? std::strong_ordering::greater : std::strong_ordering::less;
+                                }
+                        }
+                }
+                return std::strong_ordering::equal;
+        }
+
+        [[nodiscard]] constexpr std::strong_ordering set_three_way(array const& other [[maybe_unused]]) const noexcept
+        {
+                if constexpr (N > 0) {
+                        for (auto i : std::views::iota(0uz, num_blocks)) {
+                                if (auto const diff = static_cast<Block>(this->m_bits[i] ^ other.m_bits[i]); diff != zero) {
+                                        auto const n = bit::countr_zero(diff);
+                                        auto const contains_n = bit::intersects(this->m_bits[i], static_cast<Block>(unit << n));
+                                        auto const& rest = contains_n ? other : *this;
+                                        auto const rest_continues =
+                                                static_cast<Block>(rest.m_bits[i] >> n >> 1) != zero or
+                                                std::ranges::any_of(rest.m_bits | std::views::drop(i + 1), [](auto block) { return block != zero; })
+                                        ;
+                                        return contains_n == rest_continues ? std::strong_ordering::less : std::strong_ordering::greater;
+                                }
+                        }
+                }
+                return std::strong_ordering::equal;
+        }
+
+        [[nodiscard]] constexpr array deposit(array const& mask [[maybe_unused]]) const noexcept
+        {
+                auto nrv = array();
+                if constexpr (N > 0 and num_blocks == 1) {
+                        nrv.m_bits[0] = bit::pdep(m_bits[0], mask.m_bits[0]);
+                } else if constexpr (num_blocks >= 2) {
+                        auto n = 0uz;
+                        for (auto i : std::views::iota(0uz, num_blocks)) {
+                                nrv.m_bits[i] = bit::pdep(block_at(n), mask.m_bits[i]);
+                                n += bit::popcount(mask.m_bits[i]);
+                        }
+                }
+                return nrv;
+        }
+
+        [[nodiscard]] constexpr array extract(array const& mask [[maybe_unused]]) const noexcept
+        {
+                auto nrv = array();
+                if constexpr (N > 0 and num_blocks == 1) {
+                        nrv.m_bits[0] = bit::pext(m_bits[0], mask.m_bits[0]);
+                } else if constexpr (num_blocks >= 2) {
+                        auto n = 0uz;
+                        for (auto i : std::views::iota(0uz, num_blocks)) {
+                                nrv.or_block_at(n, bit::pext(m_bits[i], mask.m_bits[i]));
+                                n += bit::popcount(mask.m_bits[i]);
+                        }
+                }
+                return nrv;
+        }
+
+        // The bits [n, n + bits_per_block) as a single block, zero-filled
+        // past the last block.
+        [[nodiscard]] constexpr Block block_at(std::size_t n) const noexcept
+        {
+                auto const [ index, offset ] = index_offset(n);
+                assert(index < num_blocks);
+                if (offset == 0 or index == last_block) {
+                        return static_cast<Block>(m_bits[index] >> offset);
+                }
+                return static_cast<Block>(m_bits[index] >> offset) | static_cast<Block>(m_bits[index + 1] << (bits_per_block - offset));
+        }
+
+        // The inverse of block_at: ORs block into the bits [n, n + bits_per_block),
+        // discarding whatever would spill past the last block.
+        constexpr void or_block_at(std::size_t n, Block block) noexcept
+        {
+                auto const [ index, offset ] = index_offset(n);
+                assert(index < num_blocks);
+                m_bits[index] |= static_cast<Block>(block << offset);
+                if (offset != 0 and index != last_block) {
+                        m_bits[index + 1] |= static_cast<Block>(block >> (bits_per_block - offset));
+                }
+        }
+
         template<class Hash, class Flavor>
         constexpr void hash_append(Hash& h, Flavor const& f) noexcept
         {
@@ -574,6 +879,15 @@ private:
                 }
         }
 
+        constexpr void fill_front(std::size_t n) noexcept
+        {
+                auto const [ n_blocks, n_bits ] = div_mod(n, bits_per_block);
+                std::ranges::fill_n(m_bits.begin(), static_cast<std::ptrdiff_t>(n_blocks), ones);
+                if (n_bits != 0) {
+                        m_bits[n_blocks] |= static_cast<Block>(ones >> (bits_per_block - n_bits));
+                }
+        }
+
         template<std::random_access_iterator I, std::sized_sentinel_for<I> S>
         [[nodiscard]] static constexpr auto distance(I first, S last) noexcept
         {
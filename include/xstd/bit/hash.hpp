@@ -0,0 +1,114 @@
+#ifndef XSTD_SUBDIR_BIT_SUBDIR_HASH_HPP
+#define XSTD_SUBDIR_BIT_SUBDIR_HASH_HPP
+
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <array>        // array
+#include <concepts>     // unsigned_integral
+#include <cstddef>      // size_t
+#include <cstdint>      // uint64_t
+#include <limits>       // digits
+#include <span>         // dynamic_extent, span
+
+namespace xstd::bit {
+
+// The MurmurHash3 finalizer, a bijection on 64-bit words in which every input
+// bit affects every output bit.
+[[nodiscard]] constexpr std::uint64_t mix(std::uint64_t h) noexcept
+{
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 33;
+        h *= 0xC4CEB9FE1A85EC53ULL;
+        h ^= h >> 33;
+        return h;
+}
+
+// The next value of a splitmix64 sequence: a Weyl sequence with the golden
+// ratio increment, finalized by mix. The one source of random-looking keys,
+// seeds and multipliers throughout the library.
+[[nodiscard]] constexpr std::uint64_t splitmix64(std::uint64_t& state) noexcept
+{
+        state += 0x9E3779B97F4A7C15ULL;
+        return mix(state);
+}
+
+namespace detail {
+
+// The low and high halves of the 128-bit product of a and b, folded by XOR.
+[[nodiscard]] constexpr std::uint64_t mum(std::uint64_t a, std::uint64_t b) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+        auto const p = static_cast<__uint128_t>(a) * b;
+        return static_cast<std::uint64_t>(p) ^ static_cast<std::uint64_t>(p >> 64);
+#else
+        constexpr auto lo32 = std::uint64_t{0xFFFF'FFFF};
+        auto const ll = (a & lo32) * (b & lo32);
+        auto const lh = (a & lo32) * (b >> 32);
+        auto const hl = (a >> 32) * (b & lo32);
+        auto const hh = (a >> 32) * (b >> 32);
+        auto const mid = (ll >> 32) + (lh & lo32) + (hl & lo32);
+        return ((mid << 32) | (ll & lo32)) ^ (hh + (lh >> 32) + (hl >> 32) + (mid >> 32));
+#endif
+}
+
+// One key per word, from the splitmix64 sequence.
+template<std::size_t NumWords>
+inline constexpr auto secrets = []() {
+        auto nrv = std::array<std::uint64_t, NumWords>();
+        auto state = std::uint64_t{0};
+        for (auto& s : nrv) {
+                s = splitmix64(state);
+        }
+        return nrv;
+}();
+
+}       // namespace detail
+
+// A 64-bit hash of a fixed number of blocks, read as 64-bit words with bit i
+// of the sequence being bit i % 64 of word i / 64. A single word goes through
+// a bijective finalizer, so that sets of up to 64 elements never collide.
+// Longer inputs are hashed in the style of XXH3's mid-size path: every pair
+// of words is keyed with its own secrets and multiplied into a folded 128-bit
+// product, and the products are summed before the finalizer. The products
+// are independent of each other, so the loop runs at the throughput of the
+// multiplier rather than at its latency, at two words per multiplication,
+// instead of at the one byte per multiplication of FNV-1a.
+template<std::unsigned_integral Block, std::size_t Extent>
+        requires (Extent != std::dynamic_extent and Extent > 0)
+[[nodiscard]] constexpr std::uint64_t hash(std::span<Block const, Extent> blocks, std::uint64_t seed = 0) noexcept
+{
+        constexpr auto bits_per_block = static_cast<std::size_t>(std::numeric_limits<Block>::digits);
+        constexpr auto num_words      = (Extent * bits_per_block + 63) / 64;
+        constexpr auto const& secrets = detail::secrets<num_words + num_words % 2>;
+
+        auto const word = [&](std::size_t w) {
+                if constexpr (bits_per_block >= 64) {
+                        return static_cast<std::uint64_t>(blocks[w * 64 / bits_per_block] >> (w * 64 % bits_per_block));
+                } else {
+                        auto nrv = std::uint64_t{0};
+                        for (auto k = 0uz, b = w * 64 / bits_per_block; k < 64 / bits_per_block and b < Extent; ++k, ++b) {
+                                nrv |= static_cast<std::uint64_t>(blocks[b]) << (k * bits_per_block);
+                        }
+                        return nrv;
+                }
+        };
+
+        if constexpr (num_words == 1) {
+                return mix(word(0) ^ (secrets[0] + seed));
+        } else {
+                auto acc = (num_words * secrets[0]) ^ seed;
+                for (auto w = 0uz; w < num_words; w += 2) {
+                        auto const next = w + 1 < num_words ? word(w + 1) : 0;
+                        acc += detail::mum(word(w) ^ (secrets[w] + seed), next ^ (secrets[w + 1] - seed));
+                }
+                return mix(acc);
+        }
+}
+
+}       // namespace xstd::bit
+
+#endif  // include guard
@@ -0,0 +1,129 @@
+#ifndef XSTD_SUBDIR_BIT_SUBDIR_INTERLEAVE_HPP
+#define XSTD_SUBDIR_BIT_SUBDIR_INTERLEAVE_HPP
+
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit/array.hpp>   // array
+#include <xstd/bit/intrin.hpp>  // pdep, pext
+#include <array>                // array
+#include <bit>                  // bit_width
+#include <concepts>             // same_as, unsigned_integral
+#include <cstddef>              // size_t
+#include <limits>               // digits
+#include <ranges>               // iota
+#include <utility>              // pair
+
+namespace xstd::bit {
+
+// Morton (Z-order) interleaving of K arrays of N bits into one of K * N bits:
+// bit i of the j-th input becomes bit K * i + j of the output.
+//
+// Within a single block, the lanes = ceil(bits_per_block / K) lowest bits are
+// spread to every K-th position (and compacted back) either by a single BMI2
+// pdep (pext), or else by the classic magic-number sequence of shift-or-mask
+// steps, one step per bit of the lane index: after the steps of size at least
+// s, lane i sits at position (i mod s) + K * (i - i mod s). The masks for
+// every step are generated at compile time for any K and any Block.
+template<std::size_t K, std::unsigned_integral Block>
+struct morton
+{
+        static constexpr auto bits_per_block = static_cast<std::size_t>(std::numeric_limits<Block>::digits);
+        static constexpr auto lanes          = (bits_per_block + K - 1) / K;
+        static constexpr auto num_steps      = static_cast<std::size_t>(std::bit_width(lanes - 1));
+
+        // masks[j] holds the lane positions after the steps of size at least
+        // 2^j: masks[0] is every K-th bit, masks[num_steps] the lowest lanes.
+        static constexpr auto masks = []() {
+                auto nrv = std::array<Block, num_steps + 1>();
+                for (auto j : std::views::iota(0uz, num_steps + 1)) {
+                        auto const s = 1uz << j;
+                        for (auto i : std::views::iota(0uz, lanes)) {
+                                nrv[j] |= static_cast<Block>(static_cast<Block>(1) << (i % s + K * (i - i % s)));
+                        }
+                }
+                return nrv;
+        }();
+
+        [[nodiscard]] static constexpr Block spread(Block block) noexcept
+        {
+#if defined(XSTD_BIT_HAS_FAST_BMI2)
+                if not consteval {
+                        if constexpr (sizeof(Block) <= sizeof(unsigned long long)) {
+                                return bit::pdep(block, masks[0]);
+                        }
+                }
+#endif
+                block &= masks[num_steps];
+                for (auto j = num_steps; j-- > 0;) {
+                        block = static_cast<Block>(block | static_cast<Block>(block << ((K - 1) << j))) & masks[j];
+                }
+                return block;
+        }
+
+        [[nodiscard]] static constexpr Block compact(Block block) noexcept
+        {
+#if defined(XSTD_BIT_HAS_FAST_BMI2)
+                if not consteval {
+                        if constexpr (sizeof(Block) <= sizeof(unsigned long long)) {
+                                return bit::pext(block, masks[0]);
+                        }
+                }
+#endif
+                block &= masks[0];
+                for (auto j : std::views::iota(0uz, num_steps)) {
+                        block = static_cast<Block>(block | static_cast<Block>(block >> ((K - 1) << j))) & masks[j + 1];
+                }
+                return block;
+        }
+
+        // Output block b starts at position b * bits_per_block: its first
+        // position owned by the j-th input lies offset bits further, and holds
+        // that input's bit index.
+        [[nodiscard]] static constexpr auto first_lane(std::size_t b, std::size_t j) noexcept
+                -> std::pair<std::size_t, std::size_t>
+        {
+                auto const offset = (j + K - (b * bits_per_block) % K) % K;
+                return { offset, (b * bits_per_block + offset - j) / K };
+        }
+};
+
+template<std::size_t N, std::unsigned_integral Block, std::same_as<array<N, Block>>... Arrays>
+[[nodiscard]] constexpr auto interleave(array<N, Block> const& first, Arrays const&... rest) noexcept
+        -> array<(1 + sizeof...(Arrays)) * N, Block>
+{
+        constexpr auto K = 1 + sizeof...(Arrays);
+        using result_type = array<K * N, Block>;
+        auto const inputs = std::array<array<N, Block> const*, K>{ &first, &rest... };
+        auto nrv = result_type();
+        for (auto b : std::views::iota(0uz, result_type::num_blocks)) {
+                for (auto j : std::views::iota(0uz, K)) {
+                        if (auto const [ offset, index ] = morton<K, Block>::first_lane(b, j); index < N) {
+                                nrv.m_bits[b] |= static_cast<Block>(morton<K, Block>::spread(inputs[j]->block_at(index)) << offset);
+                        }
+                }
+        }
+        return nrv;
+}
+
+template<std::size_t K, std::size_t N, std::unsigned_integral Block>
+[[nodiscard]] constexpr auto deinterleave(array<N, Block> const& input) noexcept
+        -> std::array<array<N / K, Block>, K>
+{
+        static_assert(N % K == 0);
+        auto nrv = std::array<array<N / K, Block>, K>();
+        for (auto b : std::views::iota(0uz, array<N, Block>::num_blocks)) {
+                for (auto j : std::views::iota(0uz, K)) {
+                        if (auto const [ offset, index ] = morton<K, Block>::first_lane(b, j); index < N / K) {
+                                nrv[j].or_block_at(index, morton<K, Block>::compact(static_cast<Block>(input.m_bits[b] >> offset)));
+                        }
+                }
+        }
+        return nrv;
+}
+
+}       // namespace xstd::bit
+
+#endif  // include guard
@@ -6,10 +6,22 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          http://www.boost.org/LICENSE_1_0.txt)
 
-#include <bit>          // countl_zero, countr_zero, popcount
+#include <bit>          // byteswap, countl_zero, countr_zero, popcount
 #include <concepts>     // unsigned_integral
 #include <cstddef>      // size_t
 
+// pdep/pext are single 3-cycle instructions on Intel since Haswell and on
+// AMD since Zen 3, but microcoded on earlier AMD cores (up to hundreds of
+// cycles, depending on the mask), where the portable loops below, linear
+// in the number of mask bits, are much faster. Defining XSTD_BIT_NO_BMI2
+// forces those loops for CPUs not recognized here.
+#if !defined(XSTD_BIT_NO_BMI2) && (defined(__x86_64__) || defined(_M_X64)) && (defined(__BMI2__) || (defined(_MSC_VER) && defined(__AVX2__)))
+        #if !defined(__bdver4__) && !defined(__znver1__) && !defined(__znver2__)
+                #define XSTD_BIT_HAS_FAST_BMI2
+                #include <immintrin.h>  // _pdep_u32, _pdep_u64, _pext_u32, _pext_u64
+        #endif
+#endif
+
 namespace xstd::bit {
 
 [[nodiscard]] constexpr std::size_t countl_zero(std::unsigned_integral auto block) noexcept
@@ -27,6 +39,132 @@ namespace xstd::bit {
         return static_cast<std::size_t>(std::popcount(block));
 }
 
+template<std::unsigned_integral Block>
+[[nodiscard]] constexpr Block pdep(Block src, Block mask) noexcept
+{
+#if defined(XSTD_BIT_HAS_FAST_BMI2)
+        if not consteval {
+                if constexpr (sizeof(Block) <= sizeof(unsigned)) {
+                        return static_cast<Block>(_pdep_u32(src, mask));
+                } else if constexpr (sizeof(Block) == sizeof(unsigned long long)) {
+                        return static_cast<Block>(_pdep_u64(src, mask));
+                }
+        }
+#endif
+        auto dst = static_cast<Block>(0);
+        for (auto bit = static_cast<Block>(1); mask != 0; bit = static_cast<Block>(bit << 1)) {
+                if (src & bit) {
+                        dst |= static_cast<Block>(mask & static_cast<Block>(-mask));
+                }
+                mask &= static_cast<Block>(mask - 1);
+        }
+        return dst;
+}
+
+template<std::unsigned_integral Block>
+[[nodiscard]] constexpr Block pext(Block src, Block mask) noexcept
+{
+#if defined(XSTD_BIT_HAS_FAST_BMI2)
+        if not consteval {
+                if constexpr (sizeof(Block) <= sizeof(unsigned)) {
+                        return static_cast<Block>(_pext_u32(src, mask));
+                } else if constexpr (sizeof(Block) == sizeof(unsigned long long)) {
+                        return static_cast<Block>(_pext_u64(src, mask));
+                }
+        }
+#endif
+        auto dst = static_cast<Block>(0);
+        for (auto bit = static_cast<Block>(1); mask != 0; bit = static_cast<Block>(bit << 1)) {
+                if (src & mask & static_cast<Block>(-mask)) {
+                        dst |= bit;
+                }
+                mask &= static_cast<Block>(mask - 1);
+        }
+        return dst;
+}
+
+// lhs + rhs + carry, with carry set to the carry out of the highest bit: an
+// add-with-carry instruction (adc on x86, adcs on ARM) where the compiler has
+// a builtin for it, and otherwise the two-comparison pattern that GCC and
+// Clang recognize as one.
+template<std::unsigned_integral Block>
+[[nodiscard]] constexpr Block addc(Block lhs, Block rhs, bool& carry) noexcept
+{
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_addcll)
+        if not consteval {
+                if constexpr (sizeof(Block) == sizeof(unsigned long long)) {
+                        unsigned long long carry_out;
+                        auto const sum = __builtin_addcll(lhs, rhs, carry, &carry_out);
+                        carry = carry_out != 0;
+                        return static_cast<Block>(sum);
+                }
+        }
+#endif
+#endif
+        auto const partial = static_cast<Block>(lhs + rhs);
+        auto const sum = static_cast<Block>(partial + carry);
+        carry = partial < lhs or sum < partial;
+        return sum;
+}
+
+// lhs - rhs - borrow, with borrow set to the borrow out of the highest bit.
+template<std::unsigned_integral Block>
+[[nodiscard]] constexpr Block subb(Block lhs, Block rhs, bool& borrow) noexcept
+{
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_subcll)
+        if not consteval {
+                if constexpr (sizeof(Block) == sizeof(unsigned long long)) {
+                        unsigned long long borrow_out;
+                        auto const difference = __builtin_subcll(lhs, rhs, borrow, &borrow_out);
+                        borrow = borrow_out != 0;
+                        return static_cast<Block>(difference);
+                }
+        }
+#endif
+#endif
+        auto const partial = static_cast<Block>(lhs - rhs);
+        auto const difference = static_cast<Block>(partial - borrow);
+        borrow = lhs < rhs or partial < static_cast<Block>(borrow);
+        return difference;
+}
+
+template<std::unsigned_integral Block>
+[[nodiscard]] constexpr Block byteswap(Block block) noexcept
+{
+        return std::byteswap(block);
+}
+
+// Mirrors bit i to bit digits - 1 - i. Clang's __builtin_bitreverse maps to
+// a single rbit on ARM; elsewhere, the bytes are swapped first (a single
+// bswap on x86), then the bits within every byte by three mask-and-shift
+// steps of 4, 2 and 1 bits.
+template<std::unsigned_integral Block>
+[[nodiscard]] constexpr Block reverse(Block block) noexcept
+{
+#if defined(__clang__)
+        if constexpr (sizeof(Block) == 1) {
+                return static_cast<Block>(__builtin_bitreverse8(block));
+        } else if constexpr (sizeof(Block) == 2) {
+                return static_cast<Block>(__builtin_bitreverse16(block));
+        } else if constexpr (sizeof(Block) == 4) {
+                return static_cast<Block>(__builtin_bitreverse32(block));
+        } else if constexpr (sizeof(Block) == 8) {
+                return static_cast<Block>(__builtin_bitreverse64(block));
+        }
+#endif
+        constexpr auto ones = static_cast<Block>(-1);
+        constexpr auto m4   = static_cast<Block>(ones / 0x11);   // 0x0F0F...
+        constexpr auto m2   = static_cast<Block>(ones / 0x05);   // 0x3333...
+        constexpr auto m1   = static_cast<Block>(ones / 0x03);   // 0x5555...
+        block = std::byteswap(block);
+        block = static_cast<Block>(static_cast<Block>((block >> 4) & m4) | static_cast<Block>((block & m4) << 4));
+        block = static_cast<Block>(static_cast<Block>((block >> 2) & m2) | static_cast<Block>((block & m2) << 2));
+        block = static_cast<Block>(static_cast<Block>((block >> 1) & m1) | static_cast<Block>((block & m1) << 1));
+        return block;
+}
+
 }       // namespace xstd::bit
 
 #endif  // include guard
@@ -0,0 +1,63 @@
+#ifndef XSTD_SUBDIR_BIT_SUBDIR_TRANSPOSE_HPP
+#define XSTD_SUBDIR_BIT_SUBDIR_TRANSPOSE_HPP
+
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <array>                // array
+#include <concepts>             // unsigned_integral
+#include <cstddef>              // size_t
+#include <limits>               // digits
+#include <ranges>               // iota
+
+namespace xstd::bit {
+
+template<std::unsigned_integral Block>
+using square_matrix = std::array<Block, std::numeric_limits<Block>::digits>;
+
+namespace detail {
+
+// masks<Block>[j] holds the bits c with c & j == 0, for all powers of two j.
+template<std::unsigned_integral Block>
+inline constexpr auto masks = []() {
+        constexpr auto w = static_cast<std::size_t>(std::numeric_limits<Block>::digits);
+        auto nrv = std::array<Block, w>();
+        for (auto j = 1uz; j < w; j *= 2) {
+                for (auto c : std::views::iota(0uz, w)) {
+                        if ((c & j) == 0) {
+                                nrv[j] |= static_cast<Block>(static_cast<Block>(1) << c);
+                        }
+                }
+        }
+        return nrv;
+}();
+
+}       // namespace detail
+
+// Transposes a square bit matrix in place: bit c of row r and bit r of row c
+// trade places. Recursive block transposition (Hacker's Delight, 7-3): with
+// the matrix split into 2 x 2 blocks of size j, the two off-diagonal blocks
+// are swapped with one masked shift-XOR per pair of rows, for j = w / 2, ...,
+// 1, which takes w * log2(w) / 2 such swaps for w = bits_per_block.
+template<std::unsigned_integral Block>
+constexpr void transpose(square_matrix<Block>& m) noexcept
+{
+        constexpr auto w = static_cast<std::size_t>(std::numeric_limits<Block>::digits);
+        constexpr auto const& masks = detail::masks<Block>;
+
+        for (auto j = w / 2; j > 0; j /= 2) {
+                for (auto k : std::views::iota(0uz, w)) {
+                        if ((k & j) == 0) {
+                                auto const t = static_cast<Block>(((m[k] >> j) ^ m[k | j]) & masks[j]);
+                                m[k | j] ^= t;
+                                m[k] ^= static_cast<Block>(t << j);
+                        }
+                }
+        }
+}
+
+}       // namespace xstd::bit
+
+#endif  // include guard
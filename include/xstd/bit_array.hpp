@@ -12,6 +12,7 @@
 #include <initializer_list>     // initializer_list
 
 #include <xstd/utility.hpp>     // aligned_size
+#include <array>                // array
 #include <concepts>             // unsigned_integral
 #include <cstddef>              // size_t
 #include <limits>               // digits
@@ -27,6 +28,19 @@ template<std::size_t N, std::unsigned_integral Block> [[nodiscard]] constexpr au
 // 23.3.4, specialized algorithms
 template<std::size_t N, std::unsigned_integral Block>               constexpr void swap       (      bit_array<N, Block>& x,       bit_array<N, Block>& y) noexcept(noexcept(x.swap(y)));
 
+// Morton (Z-order) interleave and deinterleave
+template<std::size_t N, std::unsigned_integral Block> [[nodiscard]] constexpr bit_array<2 * N, Block>                interleave2  (const bit_array<N, Block>& x, const bit_array<N, Block>& y) noexcept;
+template<std::size_t N, std::unsigned_integral Block> [[nodiscard]] constexpr bit_array<3 * N, Block>                interleave3  (const bit_array<N, Block>& x, const bit_array<N, Block>& y, const bit_array<N, Block>& z) noexcept;
+template<std::size_t N, std::unsigned_integral Block> [[nodiscard]] constexpr std::array<bit_array<N / 2, Block>, 2> deinterleave2(const bit_array<N, Block>& xy) noexcept;
+template<std::size_t N, std::unsigned_integral Block> [[nodiscard]] constexpr std::array<bit_array<N / 3, Block>, 3> deinterleave3(const bit_array<N, Block>& xyz) noexcept;
+
+// arithmetic modulo 2^N, index 0 least significant
+template<std::size_t N, std::unsigned_integral Block> constexpr bool add      (      bit_array<N, Block>& x, const bit_array<N, Block>& y) noexcept;
+template<std::size_t N, std::unsigned_integral Block> constexpr bool sub      (      bit_array<N, Block>& x, const bit_array<N, Block>& y) noexcept;
+template<std::size_t N, std::unsigned_integral Block> constexpr bool increment(      bit_array<N, Block>& x) noexcept;
+template<std::size_t N, std::unsigned_integral Block> constexpr bool decrement(      bit_array<N, Block>& x) noexcept;
+template<std::size_t N, std::unsigned_integral Block> constexpr void negate   (      bit_array<N, Block>& x) noexcept;
+
 namespace aligned {
 
 template<std::size_t N, std::unsigned_integral Block = std::size_t>
@@ -36,9 +50,10 @@ using bit_array = xstd::bit_array<xstd::aligned_size(N, std::numeric_limits<Bloc
 }       // namespace xstd
 
 #include <xstd/bit/array.hpp>   // array
+#include <xstd/bit/interleave.hpp>  // deinterleave, interleave
 #include <xstd/proxy.hpp>       // begin, end, iterator, reference
 #include <xstd/utility.hpp>     // aligned_size
-#include <algorithm>            // lexicographical_compare_three_way
+#include <array>                // array
 #include <cassert>              // assert
 #include <compare>              // strong_ordering
 #include <concepts>             // unsigned_integral
@@ -147,17 +162,58 @@ template<std::size_t N, std::unsigned_integral Block> [[nodiscard]] constexpr bo
 // bit::array is a pure storage vehicle with no <=> of its own (see its
 // comments) - bit_array's own ordering is the fixed-length sequence-of-bool
 // order (index 0 first), exactly what std::array<bool, N>'s <=> would
-// compute, via its own random_access iteration over every index (not just
-// the set ones - that's bit_set's contract, a different relation).
+// compute over every index (not just the set ones - that's bit_set's
+// contract, a different relation), decided word-parallel at the first
+// differing block by bit::array::sequence_three_way.
 template<std::size_t N, std::unsigned_integral Block>
 [[nodiscard]] constexpr auto operator<=>(const bit_array<N, Block>& x, const bit_array<N, Block>& y) noexcept
         -> std::strong_ordering
 {
-        return std::lexicographical_compare_three_way(x.begin(), x.end(), y.begin(), y.end());
+        return x.m_bits.sequence_three_way(y.m_bits);
 }
 
 template<std::size_t N, std::unsigned_integral Block> constexpr void swap(bit_array<N, Block>& x, bit_array<N, Block>& y) noexcept(noexcept(x.swap(y))) { x.swap(y); }
 
+// Morton (Z-order) interleave and deinterleave: index i of x (y, z) becomes
+// index 2 * i (2 * i + 1) of the result, or 3 * i (3 * i + 1, 3 * i + 2).
+template<std::size_t N, std::unsigned_integral Block>
+[[nodiscard]] constexpr bit_array<2 * N, Block> interleave2(const bit_array<N, Block>& x, const bit_array<N, Block>& y) noexcept
+{
+        return { bit::interleave(x.m_bits, y.m_bits) };
+}
+
+template<std::size_t N, std::unsigned_integral Block>
+[[nodiscard]] constexpr bit_array<3 * N, Block> interleave3(const bit_array<N, Block>& x, const bit_array<N, Block>& y, const bit_array<N, Block>& z) noexcept
+{
+        return { bit::interleave(x.m_bits, y.m_bits, z.m_bits) };
+}
+
+template<std::size_t N, std::unsigned_integral Block>
+[[nodiscard]] constexpr std::array<bit_array<N / 2, Block>, 2> deinterleave2(const bit_array<N, Block>& xy) noexcept
+{
+        static_assert(N % 2 == 0);
+        auto const [ x, y ] = bit::deinterleave<2>(xy.m_bits);
+        return {{ { x }, { y } }};
+}
+
+template<std::size_t N, std::unsigned_integral Block>
+[[nodiscard]] constexpr std::array<bit_array<N / 3, Block>, 3> deinterleave3(const bit_array<N, Block>& xyz) noexcept
+{
+        static_assert(N % 3 == 0);
+        auto const [ x, y, z ] = bit::deinterleave<3>(xyz.m_bits);
+        return {{ { x }, { y }, { z } }};
+}
+
+// Arithmetic modulo 2^N on x as an unsigned number with index 0 the least
+// significant bit, e.g. for the bit-parallel string algorithms of Myers and
+// Hyyrö. add, sub, increment and decrement return the carry (borrow) out of
+// index N - 1.
+template<std::size_t N, std::unsigned_integral Block> constexpr bool add      (bit_array<N, Block>& x, const bit_array<N, Block>& y) noexcept { return x.m_bits.add(y.m_bits); }
+template<std::size_t N, std::unsigned_integral Block> constexpr bool sub      (bit_array<N, Block>& x, const bit_array<N, Block>& y) noexcept { return x.m_bits.sub(y.m_bits); }
+template<std::size_t N, std::unsigned_integral Block> constexpr bool increment(bit_array<N, Block>& x)                               noexcept { return x.m_bits.increment();  }
+template<std::size_t N, std::unsigned_integral Block> constexpr bool decrement(bit_array<N, Block>& x)                               noexcept { return x.m_bits.decrement();  }
+template<std::size_t N, std::unsigned_integral Block> constexpr void negate   (bit_array<N, Block>& x)                               noexcept {        x.m_bits.negate();     }
+
 }       // namespace xstd
 
 #endif  // include guard
@@ -0,0 +1,285 @@
+#ifndef XSTD_BIT_GRID_HPP
+#define XSTD_BIT_GRID_HPP
+
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit/array.hpp>   // array
+#include <algorithm>            // min
+#include <array>                // array
+#include <bit>                  // bit_width
+#include <cassert>              // assert
+#include <concepts>             // unsigned_integral
+#include <cstddef>              // ptrdiff_t, size_t
+#include <ranges>               // iota
+#include <utility>              // index_sequence, make_index_sequence
+
+namespace xstd {
+
+// The eight compass directions on a grid, with north towards increasing rows
+// and east towards increasing columns.
+enum class direction { north, north_east, east, south_east, south, south_west, west, north_west };
+
+// A W x H board of squares (x, y), stored row by row in a single bit::array:
+// square (x, y) is bit y * stride + x, with stride = W + Pad. The Pad ghost
+// columns at the end of every row are never occupied.
+//
+// Shifting a board one square in any direction moves the bits by a fixed
+// offset, except that the squares on the leaving edge would wrap around into
+// the opposite edge of the next (or previous) row. Without padding, every
+// shift is fused with a compile-time edge mask of the squares it can validly
+// land on. With Pad >= 1, a wrapping square can only land on a ghost square,
+// so that a shift fused with a target board (which never occupies ghost
+// squares, e.g. the empty squares in a move generator) needs no edge mask.
+template<std::size_t W, std::size_t H, std::unsigned_integral Block = std::size_t, std::size_t Pad = 0>
+class bit_grid
+{
+        static_assert(W > 0 and H > 0);
+
+public:
+        static constexpr auto width  = W;
+        static constexpr auto height = H;
+        static constexpr auto stride = W + Pad;
+
+private:
+        using array_type = bit::array<stride * H, Block>;
+
+        static constexpr auto bits_per_block = array_type::bits_per_block;
+        static constexpr auto num_blocks     = array_type::num_blocks;
+        static constexpr auto zero           = static_cast<Block>(0);
+
+        array_type m_bits{};
+
+        template<class Predicate>
+        [[nodiscard]] static constexpr bit_grid make(Predicate pred) noexcept
+        {
+                bit_grid nrv;
+                for (auto y : std::views::iota(0uz, H)) {
+                        for (auto x : std::views::iota(0uz, W)) {
+                                if (pred(x, y)) {
+                                        nrv.insert(x, y);
+                                }
+                        }
+                }
+                return nrv;
+        }
+
+public:
+        // The column and row steps in direction d, indexed by direction.
+        [[nodiscard]] static constexpr std::ptrdiff_t dx(direction d) noexcept
+        {
+                constexpr std::array<std::ptrdiff_t, 8> table = { 0,  1,  1,  1,  0, -1, -1, -1 };
+                return table[static_cast<std::size_t>(d)];
+        }
+
+        [[nodiscard]] static constexpr std::ptrdiff_t dy(direction d) noexcept
+        {
+                constexpr std::array<std::ptrdiff_t, 8> table = { 1,  1,  0, -1, -1, -1,  0,  1 };
+                return table[static_cast<std::size_t>(d)];
+        }
+
+        // The bit offset of a single step in direction d.
+        [[nodiscard]] static constexpr std::ptrdiff_t offset(direction d) noexcept
+        {
+                return dy(d) * static_cast<std::ptrdiff_t>(stride) + dx(d);
+        }
+
+        [[nodiscard]] static constexpr std::size_t index(std::size_t x, std::size_t y) noexcept
+        {
+                assert(x < W and y < H);
+                return y * stride + x;
+        }
+
+        [[nodiscard]] static constexpr bit_grid squares() noexcept
+        {
+                return make([](auto, auto) { return true; });
+        }
+
+        [[nodiscard]] static constexpr bit_grid column(std::size_t c) noexcept
+        {
+                return make([=](auto x, auto) { return x == c; });
+        }
+
+        [[nodiscard]] static constexpr bit_grid row(std::size_t r) noexcept
+        {
+                return make([=](auto, auto y) { return y == r; });
+        }
+
+        // The squares that a translation by DX columns and DY rows reaches
+        // from a square on the board.
+        template<std::ptrdiff_t DX, std::ptrdiff_t DY>
+        [[nodiscard]] static constexpr bit_grid translate_mask() noexcept
+        {
+                return make([](auto x, auto y) {
+                        auto const from_x = static_cast<std::ptrdiff_t>(x) - DX;
+                        auto const from_y = static_cast<std::ptrdiff_t>(y) - DY;
+                        return
+                                0 <= from_x and from_x < static_cast<std::ptrdiff_t>(W) and
+                                0 <= from_y and from_y < static_cast<std::ptrdiff_t>(H)
+                        ;
+                });
+        }
+
+        // The squares that a step in direction D reaches from a square on the board.
+        template<direction D>
+        [[nodiscard]] static constexpr bit_grid edge_mask() noexcept
+        {
+                return translate_mask<dx(D), dy(D)>();
+        }
+
+        [[nodiscard]] constexpr bool contains(std::size_t x, std::size_t y) const noexcept { return m_bits[index(x, y)]; }
+        constexpr void insert(std::size_t x, std::size_t y) noexcept { m_bits.set  (index(x, y)); }
+        constexpr void erase (std::size_t x, std::size_t y) noexcept { m_bits.reset(index(x, y)); }
+
+        [[nodiscard]] constexpr bool        empty() const noexcept { return m_bits.none();  }
+        [[nodiscard]] constexpr std::size_t size()  const noexcept { return m_bits.count(); }
+        constexpr void clear() noexcept { m_bits.reset(); }
+
+        [[nodiscard]] constexpr bool operator==(const bit_grid&) const noexcept = default;
+
+        constexpr bit_grid& operator&=(const bit_grid& other) noexcept { this->m_bits &= other.m_bits; return *this; }
+        constexpr bit_grid& operator|=(const bit_grid& other) noexcept { this->m_bits |= other.m_bits; return *this; }
+        constexpr bit_grid& operator^=(const bit_grid& other) noexcept { this->m_bits ^= other.m_bits; return *this; }
+        constexpr bit_grid& operator-=(const bit_grid& other) noexcept { this->m_bits -= other.m_bits; return *this; }
+
+        [[nodiscard]] friend constexpr bit_grid operator~(const bit_grid& lhs) noexcept
+        {
+                constexpr auto all = squares();
+                auto nrv = all;
+                nrv -= lhs;
+                return nrv;
+        }
+
+        [[nodiscard]] friend constexpr bit_grid operator&(const bit_grid& lhs, const bit_grid& rhs) noexcept { auto nrv = lhs; nrv &= rhs; return nrv; }
+        [[nodiscard]] friend constexpr bit_grid operator|(const bit_grid& lhs, const bit_grid& rhs) noexcept { auto nrv = lhs; nrv |= rhs; return nrv; }
+        [[nodiscard]] friend constexpr bit_grid operator^(const bit_grid& lhs, const bit_grid& rhs) noexcept { auto nrv = lhs; nrv ^= rhs; return nrv; }
+        [[nodiscard]] friend constexpr bit_grid operator-(const bit_grid& lhs, const bit_grid& rhs) noexcept { auto nrv = lhs; nrv -= rhs; return nrv; }
+
+        // Every square moved one step in direction D, dropping those that
+        // would leave the board.
+        template<direction D>
+        [[nodiscard]] constexpr bit_grid shift() const noexcept
+        {
+                constexpr auto mask = edge_mask<D>();
+                return shifted<offset(D)>(mask);
+        }
+
+        // Every square moved DX columns east and DY rows north (west and
+        // south for negative values), dropping those that leave the board.
+        template<std::ptrdiff_t DX, std::ptrdiff_t DY>
+        [[nodiscard]] constexpr bit_grid translate() const noexcept
+        {
+                constexpr auto mask = translate_mask<DX, DY>();
+                return shifted<DY * static_cast<std::ptrdiff_t>(stride) + DX>(mask);
+        }
+
+        // shift<D>() & target, computed in the same single pass.
+        template<direction D>
+        [[nodiscard]] constexpr bit_grid shift(const bit_grid& target) const noexcept
+        {
+                if constexpr (Pad == 0) {
+                        constexpr auto mask = edge_mask<D>();
+                        return shifted<offset(D)>(mask, target);
+                } else {
+                        return shifted<offset(D)>(target);
+                }
+        }
+
+        // Parallel-prefix (Kogge-Stone) occluded fill: the generators together
+        // with every square reachable from them by sliding in direction D
+        // over the empty squares. The propagator set of squares that can pass
+        // on a slide doubles its reach in every round, so that a board of
+        // extent n takes ceil(log2(n)) rounds instead of n - 1 single steps.
+        // The attacked squares of a sliding piece are fill<D>(...).shift<D>().
+        template<direction D>
+        [[nodiscard]] friend constexpr bit_grid fill(bit_grid generators, bit_grid empty) noexcept
+        {
+                if constexpr (Pad == 0) {
+                        constexpr auto mask = edge_mask<D>();
+                        empty &= mask;
+                }
+                [&]<std::size_t... R>(std::index_sequence<R...>) {
+                        ((
+                                generators |= generators.template shifted<(std::ptrdiff_t{1} << R) * offset(D)>(empty),
+                                empty = empty.template shifted<(std::ptrdiff_t{1} << R) * offset(D)>(empty)
+                        ), ...);
+                }(std::make_index_sequence<rounds(D)>());
+                return generators;
+        }
+
+        // The squares of passable connected to those of seed, through the
+        // 4 orthogonal or all 8 neighbors. Every iteration slides through
+        // passable in all these directions with the fills above, until
+        // nothing changes.
+        template<std::size_t Neighbors = 4>
+        [[nodiscard]] friend constexpr bit_grid flood_fill(const bit_grid& seed, const bit_grid& passable) noexcept
+        {
+                static_assert(Neighbors == 4 or Neighbors == 8);
+                auto filled = seed & passable;
+                for (auto previous = bit_grid(); filled != previous;) {
+                        previous = filled;
+                        filled = fill<direction::north>(filled, passable);
+                        filled = fill<direction::east >(filled, passable);
+                        filled = fill<direction::south>(filled, passable);
+                        filled = fill<direction::west >(filled, passable);
+                        if constexpr (Neighbors == 8) {
+                                filled = fill<direction::north_east>(filled, passable);
+                                filled = fill<direction::south_east>(filled, passable);
+                                filled = fill<direction::south_west>(filled, passable);
+                                filled = fill<direction::north_west>(filled, passable);
+                        }
+                }
+                return filled;
+        }
+
+private:
+        // The rounds of doubling needed to cover the longest possible
+        // slide in direction d.
+        [[nodiscard]] static constexpr std::size_t rounds(direction d) noexcept
+        {
+                auto const extent = dx(d) == 0 ? H : dy(d) == 0 ? W : std::min(W, H);
+                return static_cast<std::size_t>(std::bit_width(extent - 1));
+        }
+
+        // Block i of m_bits, zero outside the array.
+        [[nodiscard]] constexpr Block block(std::ptrdiff_t i) const noexcept
+        {
+                return 0 <= i and i < static_cast<std::ptrdiff_t>(num_blocks) ? m_bits.m_bits[static_cast<std::size_t>(i)] : zero;
+        }
+
+        // The bits moved up by N (down for negative N) and ANDed with all
+        // masks, in a single pass: every output block is a funnel shift of
+        // two neighboring source blocks, and a lone shift for a single block.
+        template<std::ptrdiff_t N, class... Masks>
+        [[nodiscard]] constexpr bit_grid shifted(const Masks&... masks) const noexcept
+        {
+                constexpr auto n_bits   = static_cast<std::size_t>(N < 0 ? -N : N);
+                constexpr auto n_blocks = static_cast<std::ptrdiff_t>(n_bits / bits_per_block);
+                constexpr auto L_shift  = n_bits % bits_per_block;
+                constexpr auto R_shift  = bits_per_block - L_shift;
+                bit_grid nrv;
+                for (auto i : std::views::iota(0uz, num_blocks)) {
+                        auto const j = static_cast<std::ptrdiff_t>(i);
+                        auto b = zero;
+                        if constexpr (n_bits >= num_blocks * bits_per_block) {
+                                // everything is shifted out
+                        } else if constexpr (N >= 0 and L_shift == 0) {
+                                b = block(j - n_blocks);
+                        } else if constexpr (N >= 0) {
+                                b = static_cast<Block>(block(j - n_blocks) << L_shift) | static_cast<Block>(block(j - n_blocks - 1) >> R_shift);
+                        } else if constexpr (L_shift == 0) {
+                                b = block(j + n_blocks);
+                        } else {
+                                b = static_cast<Block>(block(j + n_blocks) >> L_shift) | static_cast<Block>(block(j + n_blocks + 1) << R_shift);
+                        }
+                        nrv.m_bits.m_bits[i] = static_cast<Block>((b & ... & masks.m_bits.m_bits[i]));
+                }
+                return nrv;
+        }
+};
+
+}       // namespace xstd
+
+#endif  // include guard
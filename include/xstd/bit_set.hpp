@@ -12,6 +12,7 @@
 #include <initializer_list>     // initializer_list
 
 #include <xstd/utility.hpp>     // aligned_size
+#include <array>                // array
 #include <concepts>             // unsigned_integral
 #include <cstddef>              // size_t
 #include <limits>               // digits
@@ -30,6 +31,21 @@ template<std::size_t N, std::unsigned_integral Block>               constexpr vo
 template<std::size_t N, std::unsigned_integral Block, class Predicate>
 constexpr typename bit_set<N, Block>::size_type erase_if(bit_set<N, Block>& c, Predicate pred);
 
+// subset enumeration
+template<std::size_t N, std::unsigned_integral Block>                          constexpr bool          next_combination         (      bit_set<N, Block>& c) noexcept;
+template<std::size_t N, std::unsigned_integral Block, class UnaryFunction>     constexpr UnaryFunction for_each_submask         (const bit_set<N, Block>& mask, UnaryFunction f);
+template<std::size_t N, std::unsigned_integral Block, class UnaryFunction>     constexpr UnaryFunction for_each_gray_code_subset(const bit_set<N, Block>& mask, UnaryFunction f);
+
+// parallel bit deposit and extract
+template<std::size_t N, std::unsigned_integral Block> [[nodiscard]] constexpr bit_set<N, Block> deposit(const bit_set<N, Block>& src, const bit_set<N, Block>& mask) noexcept;
+template<std::size_t N, std::unsigned_integral Block> [[nodiscard]] constexpr bit_set<N, Block> extract(const bit_set<N, Block>& src, const bit_set<N, Block>& mask) noexcept;
+
+// Morton (Z-order) interleave and deinterleave
+template<std::size_t N, std::unsigned_integral Block> [[nodiscard]] constexpr bit_set<2 * N, Block>                interleave2  (const bit_set<N, Block>& x, const bit_set<N, Block>& y) noexcept;
+template<std::size_t N, std::unsigned_integral Block> [[nodiscard]] constexpr bit_set<3 * N, Block>                interleave3  (const bit_set<N, Block>& x, const bit_set<N, Block>& y, const bit_set<N, Block>& z) noexcept;
+template<std::size_t N, std::unsigned_integral Block> [[nodiscard]] constexpr std::array<bit_set<N / 2, Block>, 2> deinterleave2(const bit_set<N, Block>& xy) noexcept;
+template<std::size_t N, std::unsigned_integral Block> [[nodiscard]] constexpr std::array<bit_set<N / 3, Block>, 3> deinterleave3(const bit_set<N, Block>& xyz) noexcept;
+
 namespace aligned {
 
 template<std::size_t N, std::unsigned_integral Block = std::size_t>
@@ -39,23 +55,27 @@ using bit_set = xstd::bit_set<xstd::aligned_size(N, std::numeric_limits<Block>::
 }       // namespace xstd
 
 #include <xstd/bit/array.hpp>           // array
+#include <xstd/bit/hash.hpp>            // hash
+#include <xstd/bit/interleave.hpp>      // deinterleave, interleave
+#include <xstd/bit/intrin.hpp>          // countr_zero
 #include <xstd/proxy.hpp>               // const_iterator, const_reference
-#include <boost/hash2/fnv1a.hpp>        // fnv1a_64
 #include <boost/hash2/hash_append.hpp>  // hash_append
-#include <algorithm>                    // lexicographical_compare_three_way
+#include <algorithm>                    // copy
+#include <array>                        // array
 #include <cassert>                      // assert
 #include <compare>                      // strong_ordering
 #include <concepts>                     // constructible_from, unsigned_integral
 #include <cstddef>                      // ptrdiff_t, size_t
-#include <functional>                   // less
+#include <functional>                   // hash, less
 #include <initializer_list>             // initializer_list
 #include <iterator>                     // make_reverse_iterator, reverse_iterator, 
                                         // input_iterator, sentinel_for
 #include <limits>                       // digits
 #include <ranges>                       // begin, empty, end, from_range_t, next, rbegin, rend
-                                        // input_range
+                                        // input_range, iota
+#include <span>                         // span
 #include <type_traits>                  // conditional_t
-#include <utility>                      // forward, move, pair
+#include <utility>                      // as_const, forward, move, pair
 
 // Class template set                                                      [set]
 // Overview                                                       [set.overview]
@@ -72,6 +92,24 @@ class bit_set
         [[nodiscard]] friend constexpr std::size_t find_next (const bit_set& c, std::size_t n) noexcept { return c.m_bits.find_next(n); }
         [[nodiscard]] friend constexpr std::size_t find_prev (const bit_set& c, std::size_t n) noexcept { return c.m_bits.find_prev(n); }
 
+        // The underlying blocks, element i being bit i % digits of block i / digits.
+        [[nodiscard]] friend constexpr auto blocks(const bit_set& c) noexcept { return std::span(c.m_bits.m_bits); }
+
+        // Assigns block i of the underlying blocks. Bits past N are cleared, so
+        // that the set stays valid whatever block is assigned.
+        friend constexpr void set_block(bit_set& c, std::size_t i, Block block) noexcept
+        {
+                constexpr auto last_block    = num_blocks - 1;
+                constexpr auto num_used_bits = N - last_block * bits_per_block;
+                assert(i <= last_block);
+                if constexpr (num_used_bits < bits_per_block) {
+                        if (i == last_block) {
+                                block &= static_cast<Block>(~(static_cast<Block>(-1) << num_used_bits));
+                        }
+                }
+                c.m_bits.m_bits[i] = block;
+        }
+
         template<class Provider, class Hash, class Flavor>
         friend constexpr void tag_invoke(boost::hash2::hash_append_tag const&, Provider const&, Hash& h, Flavor const& f, bit_set const* v) noexcept
         {
@@ -96,6 +134,10 @@ public:
         using reverse_iterator       = std::reverse_iterator<iterator>;
         using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
+        // the layout of blocks(), for algorithms working a block at a time
+        static constexpr auto bits_per_block = bit::array<N, Block>::bits_per_block;
+        static constexpr auto num_blocks     = bit::array<N, Block>::num_blocks;
+
         // 23.4.6.2, construct/copy/destroy
         [[nodiscard]] constexpr bit_set() noexcept = default;
 
@@ -127,6 +169,18 @@ public:
 
         friend constexpr bool operator==  <>(const bit_set&, const bit_set&) noexcept;
         friend constexpr auto operator<=> <>(const bit_set&, const bit_set&) noexcept -> std::strong_ordering;
+        friend constexpr bool next_combination<>(bit_set&) noexcept;
+
+        template<std::size_t M, std::unsigned_integral B, class UnaryFunction>
+        friend constexpr UnaryFunction for_each_submask(const bit_set<M, B>&, UnaryFunction);
+
+        friend constexpr bit_set deposit<>(const bit_set&, const bit_set&) noexcept;
+        friend constexpr bit_set extract<>(const bit_set&, const bit_set&) noexcept;
+
+        template<std::size_t M, std::unsigned_integral B> friend constexpr bit_set<2 * M, B>                interleave2  (const bit_set<M, B>&, const bit_set<M, B>&) noexcept;
+        template<std::size_t M, std::unsigned_integral B> friend constexpr bit_set<3 * M, B>                interleave3  (const bit_set<M, B>&, const bit_set<M, B>&, const bit_set<M, B>&) noexcept;
+        template<std::size_t M, std::unsigned_integral B> friend constexpr std::array<bit_set<M / 2, B>, 2> deinterleave2(const bit_set<M, B>&) noexcept;
+        template<std::size_t M, std::unsigned_integral B> friend constexpr std::array<bit_set<M / 3, B>, 3> deinterleave3(const bit_set<M, B>&) noexcept;
 
         // iterators
         [[nodiscard]] constexpr auto begin (this auto&& self) noexcept { return proxy::bidirectional::begin(self); }
@@ -244,6 +298,12 @@ public:
         constexpr bit_set& operator<<=(std::size_t n) noexcept { m_bits <<= n; return *this; }
         constexpr bit_set& operator>>=(std::size_t n) noexcept { m_bits >>= n; return *this; }
 
+        // rotations modulo N, and mirroring x to N - 1 - x (bit by bit, or byte by byte)
+        constexpr bit_set& rotl    (std::size_t n) noexcept                        { m_bits.rotl(n);     return *this; }
+        constexpr bit_set& rotr    (std::size_t n) noexcept                        { m_bits.rotr(n);     return *this; }
+        constexpr bit_set& reverse ()              noexcept                        { m_bits.reverse();   return *this; }
+        constexpr bit_set& byteswap()              noexcept requires (N % 8 == 0)  { m_bits.byteswap();  return *this; }
+
         // observers
         [[nodiscard]] constexpr   key_compare   key_comp() const noexcept { return   key_compare(); }
         [[nodiscard]] constexpr value_compare value_comp() const noexcept { return value_compare(); }
@@ -271,12 +331,13 @@ template<std::size_t N, std::unsigned_integral Block> [[nodiscard]] constexpr bo
 // bit::array is a pure storage vehicle with no <=> of its own (see its
 // comments) - bit_set's own ordering is std::set<int>-equivalent: the
 // lexicographic order of its own ascending sequence of set-bit indices,
-// exactly what std::set<int> would compute for the same elements.
+// exactly what std::set<int> would compute for the same elements, decided
+// word-parallel at the first differing block by bit::array::set_three_way.
 template<std::size_t N, std::unsigned_integral Block>
 [[nodiscard]] constexpr auto operator<=>(const bit_set<N, Block>& x, const bit_set<N, Block>& y) noexcept
         -> std::strong_ordering
 {
-        return std::lexicographical_compare_three_way(x.begin(), x.end(), y.begin(), y.end());
+        return x.m_bits.set_three_way(y.m_bits);
 }
 template<std::size_t N, std::unsigned_integral Block>               constexpr void swap       (      bit_set<N, Block>& x,       bit_set<N, Block>& y) noexcept(noexcept(x.swap(y)))    { x.swap(y);                    }
 
@@ -295,6 +356,114 @@ constexpr typename bit_set<N, Block>::size_type erase_if(bit_set<N, Block>& c, P
         return original_size - c.size();
 }
 
+// subset enumeration
+
+// Advances c to the next set of the same size in colexicographical order
+// (Gosper's hack). Returns false after wrapping around from the last such
+// set to the first one, same as std::next_permutation.
+template<std::size_t N, std::unsigned_integral Block>
+constexpr bool next_combination(bit_set<N, Block>& c) noexcept
+{
+        return c.m_bits.next_combination();
+}
+
+// Calls f on every subset of mask, from mask itself down to the empty set,
+// in decreasing order of their underlying bit patterns.
+template<std::size_t N, std::unsigned_integral Block, class UnaryFunction>
+constexpr UnaryFunction for_each_submask(const bit_set<N, Block>& mask, UnaryFunction f)
+{
+        auto submask = mask;
+        do {
+                f(std::as_const(submask));
+        } while (submask.m_bits.prev_submask(mask.m_bits));
+        return f;
+}
+
+// Calls f on every subset of mask, starting from the empty set, in reflected
+// binary Gray code order: each subset differs from the previous one by
+// exactly one element, the one indexed by the trailing zeros of the step.
+template<std::size_t N, std::unsigned_integral Block, class UnaryFunction>
+constexpr UnaryFunction for_each_gray_code_subset(const bit_set<N, Block>& mask, UnaryFunction f)
+{
+        auto elements = std::array<std::size_t, std::numeric_limits<std::size_t>::digits - 1>();
+        assert(mask.size() <= elements.size());
+        std::ranges::copy(mask, elements.begin());
+        auto subset = bit_set<N, Block>();
+        f(std::as_const(subset));
+        for (auto step : std::views::iota(1uz, 1uz << mask.size())) {
+                subset.complement(elements[bit::countr_zero(step)]);
+                f(std::as_const(subset));
+        }
+        return f;
+}
+
+// parallel bit deposit and extract
+
+// Scatters the lowest mask.size() elements of src to the positions of the
+// elements of mask (BMI2 pdep, generalized across blocks): the i-th element
+// of mask is in the result if and only if i is in src.
+template<std::size_t N, std::unsigned_integral Block>
+[[nodiscard]] constexpr bit_set<N, Block> deposit(const bit_set<N, Block>& src, const bit_set<N, Block>& mask) noexcept
+{
+        bit_set<N, Block> nrv;
+        nrv.m_bits = src.m_bits.deposit(mask.m_bits);
+        return nrv;
+}
+
+// Gathers the elements of src at the positions of the elements of mask into
+// the lowest mask.size() positions (BMI2 pext, generalized across blocks):
+// i is in the result if and only if the i-th element of mask is in src.
+template<std::size_t N, std::unsigned_integral Block>
+[[nodiscard]] constexpr bit_set<N, Block> extract(const bit_set<N, Block>& src, const bit_set<N, Block>& mask) noexcept
+{
+        bit_set<N, Block> nrv;
+        nrv.m_bits = src.m_bits.extract(mask.m_bits);
+        return nrv;
+}
+
+// Morton (Z-order) interleave and deinterleave
+
+// Element i of x (y, z) becomes element 2 * i (2 * i + 1) of the result,
+// or element 3 * i (3 * i + 1, 3 * i + 2) for three operands.
+template<std::size_t N, std::unsigned_integral Block>
+[[nodiscard]] constexpr bit_set<2 * N, Block> interleave2(const bit_set<N, Block>& x, const bit_set<N, Block>& y) noexcept
+{
+        bit_set<2 * N, Block> nrv;
+        nrv.m_bits = bit::interleave(x.m_bits, y.m_bits);
+        return nrv;
+}
+
+template<std::size_t N, std::unsigned_integral Block>
+[[nodiscard]] constexpr bit_set<3 * N, Block> interleave3(const bit_set<N, Block>& x, const bit_set<N, Block>& y, const bit_set<N, Block>& z) noexcept
+{
+        bit_set<3 * N, Block> nrv;
+        nrv.m_bits = bit::interleave(x.m_bits, y.m_bits, z.m_bits);
+        return nrv;
+}
+
+template<std::size_t N, std::unsigned_integral Block>
+[[nodiscard]] constexpr std::array<bit_set<N / 2, Block>, 2> deinterleave2(const bit_set<N, Block>& xy) noexcept
+{
+        static_assert(N % 2 == 0);
+        auto const [ x, y ] = bit::deinterleave<2>(xy.m_bits);
+        std::array<bit_set<N / 2, Block>, 2> nrv;
+        nrv[0].m_bits = x;
+        nrv[1].m_bits = y;
+        return nrv;
+}
+
+template<std::size_t N, std::unsigned_integral Block>
+[[nodiscard]] constexpr std::array<bit_set<N / 3, Block>, 3> deinterleave3(const bit_set<N, Block>& xyz) noexcept
+{
+        static_assert(N % 3 == 0);
+        auto const [ x, y, z ] = bit::deinterleave<3>(xyz.m_bits);
+        std::array<bit_set<N / 3, Block>, 3> nrv;
+        nrv[0].m_bits = x;
+        nrv[1].m_bits = y;
+        nrv[2].m_bits = z;
+        return nrv;
+}
+
 // bitwise operators
 template<std::size_t N, std::unsigned_integral Block> [[nodiscard]] constexpr bit_set<N, Block> operator~(const bit_set<N, Block>& lhs) noexcept { auto nrv = lhs; nrv.complement(); return nrv; }
 
@@ -308,4 +477,19 @@ template<std::size_t N, std::unsigned_integral Block> [[nodiscard]] constexpr bi
 
 }       // namespace xstd
 
+namespace std {
+
+// The blocks are mixed a 64-bit word at a time, see the std::hash<xstd::bitset>
+// specialization.
+template<size_t N, unsigned_integral Block>
+struct hash<xstd::bit_set<N, Block>>
+{
+        [[nodiscard]] constexpr std::size_t operator()(xstd::bit_set<N, Block> const& v) const noexcept
+        {
+                return static_cast<std::size_t>(xstd::bit::hash(blocks(v)));
+        }
+};
+
+}       // namespace std
+
 #endif  // include guard
@@ -0,0 +1,285 @@
+#ifndef XSTD_BIT_SET_ARRAY_HPP
+#define XSTD_BIT_SET_ARRAY_HPP
+
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit/intrin.hpp>  // countr_zero, popcount
+#include <xstd/bit_set.hpp>     // bit_set
+#include <array>                // array
+#include <cassert>              // assert
+#include <concepts>             // same_as, unsigned_integral
+#include <cstddef>              // size_t
+#include <cstdint>              // uint64_t
+#include <ranges>               // input_range, range_value_t
+                                // iota
+#include <type_traits>          // conditional_t
+#include <utility>              // exchange
+#include <vector>               // vector
+
+namespace xstd {
+
+// A sequence of bit_set<N, Block> in a tiled structure-of-arrays layout:
+// every tile of tile_size consecutive sets stores block 0 of all its sets,
+// then block 1, and so on. The bulk operations (a mask applied to all sets,
+// the cardinalities of all sets, filters against a mask) then run their
+// inner loops across the sets of a tile, which vectorize, instead of across
+// the few blocks of a single set, which do not. Within a tile, all blocks
+// of a set stay within a few cache lines.
+//
+// The sets are accessed through proxies that convert to and from bit_set.
+// The lanes of the last tile past size() hold unspecified blocks.
+template<std::size_t N, std::unsigned_integral Block = std::size_t>
+class bit_set_array
+{
+public:
+        using value_type = bit_set<N, Block>;
+        using size_type  = std::size_t;
+
+        static constexpr auto tile_size = 64uz;        // one bit per set in a uint64_t
+
+private:
+        static constexpr auto bits_per_block = value_type::bits_per_block;
+        static constexpr auto num_blocks     = value_type::num_blocks;
+        static constexpr auto tile_blocks    = num_blocks * tile_size;
+
+        std::vector<Block> m_blocks;
+        size_type m_size = 0;
+
+        [[nodiscard]] static constexpr size_type num_tiles(size_type n) noexcept
+        {
+                return (n + tile_size - 1) / tile_size;
+        }
+
+        [[nodiscard]] static constexpr size_type offset(size_type i, size_type b) noexcept
+        {
+                return i / tile_size * tile_blocks + b * tile_size + i % tile_size;
+        }
+
+        [[nodiscard]] constexpr Block  block(size_type i, size_type b) const noexcept { return m_blocks[offset(i, b)]; }
+        [[nodiscard]] constexpr Block& block(size_type i, size_type b)       noexcept { return m_blocks[offset(i, b)]; }
+
+        template<bool Const>
+        class proxy
+        {
+                friend bit_set_array;
+                template<bool> friend class proxy;
+                using array_pointer = std::conditional_t<Const, bit_set_array const*, bit_set_array*>;
+
+                array_pointer m_array;
+                size_type m_index;
+
+                constexpr proxy(array_pointer a, size_type i) noexcept
+                :
+                        m_array(a),
+                        m_index(i)
+                {}
+
+                [[nodiscard]] constexpr Block bit(size_type x) const noexcept
+                {
+                        assert(x < N);
+                        return static_cast<Block>(static_cast<Block>(1) << (x % bits_per_block));
+                }
+
+        public:
+                constexpr proxy(proxy const&) noexcept = default;
+
+                // Copies a mutable proxy to a const one.
+                constexpr proxy(proxy<false> const& other) noexcept requires Const
+                :
+                        m_array(other.m_array),
+                        m_index(other.m_index)
+                {}
+
+                [[nodiscard]] constexpr operator value_type() const noexcept
+                {
+                        auto nrv = value_type();
+                        for (auto b : std::views::iota(0uz, num_blocks)) {
+                                set_block(nrv, b, m_array->block(m_index, b));
+                        }
+                        return nrv;
+                }
+
+                constexpr proxy const& operator=(value_type const& s) const noexcept requires (not Const)
+                {
+                        auto const src = blocks(s);
+                        for (auto b : std::views::iota(0uz, num_blocks)) {
+                                m_array->block(m_index, b) = src[b];
+                        }
+                        return *this;
+                }
+
+                constexpr proxy const& operator=(proxy const& other) const noexcept requires (not Const)
+                {
+                        return *this = static_cast<value_type>(other);
+                }
+
+                [[nodiscard]] constexpr bool contains(size_type x) const noexcept
+                {
+                        return m_array->block(m_index, x / bits_per_block) & bit(x);
+                }
+
+                [[nodiscard]] constexpr size_type size() const noexcept
+                {
+                        auto n = 0uz;
+                        for (auto b : std::views::iota(0uz, num_blocks)) {
+                                n += bit::popcount(m_array->block(m_index, b));
+                        }
+                        return n;
+                }
+
+                [[nodiscard]] constexpr bool empty() const noexcept
+                {
+                        for (auto b : std::views::iota(0uz, num_blocks)) {
+                                if (m_array->block(m_index, b) != 0) {
+                                        return false;
+                                }
+                        }
+                        return true;
+                }
+
+                constexpr void insert    (size_type x) const noexcept requires (not Const) { m_array->block(m_index, x / bits_per_block) |= bit(x);                       }
+                constexpr void erase     (size_type x) const noexcept requires (not Const) { m_array->block(m_index, x / bits_per_block) &= static_cast<Block>(~bit(x)); }
+                constexpr void complement(size_type x) const noexcept requires (not Const) { m_array->block(m_index, x / bits_per_block) ^= bit(x);                       }
+
+                constexpr void clear() const noexcept requires (not Const)
+                {
+                        for (auto b : std::views::iota(0uz, num_blocks)) {
+                                m_array->block(m_index, b) = 0;
+                        }
+                }
+
+                [[nodiscard]] friend constexpr bool operator==(proxy const& lhs, value_type const& rhs) noexcept
+                {
+                        return static_cast<value_type>(lhs) == rhs;
+                }
+        };
+
+        // The indices of the sets for which the OR over all blocks of
+        // f(set block, mask block) is non-zero (or zero).
+        template<class BinaryFunction>
+        [[nodiscard]] constexpr std::vector<size_type> select(value_type const& mask, BinaryFunction f, bool nonzero) const
+        {
+                auto result = std::vector<size_type>();
+                auto const m = blocks(mask);
+                for (auto t : std::views::iota(0uz, num_tiles(m_size))) {
+                        auto acc = std::array<Block, tile_size>();
+                        for (auto b : std::views::iota(0uz, num_blocks)) {
+                                auto const plane = m_blocks.data() + t * tile_blocks + b * tile_size;
+                                for (auto lane : std::views::iota(0uz, tile_size)) {
+                                        acc[lane] |= f(plane[lane], m[b]);
+                                }
+                        }
+                        auto hits = std::uint64_t{0};
+                        for (auto lane : std::views::iota(0uz, tile_size)) {
+                                hits |= static_cast<std::uint64_t>((acc[lane] != 0) == nonzero) << lane;
+                        }
+                        if (auto const tail = m_size - t * tile_size; tail < tile_size) {
+                                hits &= (std::uint64_t{1} << tail) - 1;
+                        }
+                        for (; hits != 0; hits &= hits - 1) {
+                                result.push_back(t * tile_size + bit::countr_zero(hits));
+                        }
+                }
+                return result;
+        }
+
+        template<class BinaryFunction>
+        constexpr void transform(value_type const& mask, BinaryFunction f) noexcept
+        {
+                auto const m = blocks(mask);
+                for (auto t : std::views::iota(0uz, num_tiles(m_size))) {
+                        for (auto b : std::views::iota(0uz, num_blocks)) {
+                                auto const plane = m_blocks.data() + t * tile_blocks + b * tile_size;
+                                for (auto lane : std::views::iota(0uz, tile_size)) {
+                                        plane[lane] = f(plane[lane], m[b]);
+                                }
+                        }
+                }
+        }
+
+public:
+        using reference       = proxy<false>;
+        using const_reference = proxy<true>;
+
+        constexpr bit_set_array() = default;
+
+        // n empty sets.
+        constexpr explicit bit_set_array(size_type n)
+        {
+                resize(n);
+        }
+
+        template<std::ranges::input_range R>
+                requires std::same_as<std::ranges::range_value_t<R>, value_type>
+        constexpr explicit bit_set_array(R const& sets)
+        {
+                for (auto const& s : sets) {
+                        push_back(s);
+                }
+        }
+
+        [[nodiscard]] constexpr size_type size() const noexcept { return m_size;      }
+        [[nodiscard]] constexpr bool     empty() const noexcept { return m_size == 0; }
+
+        [[nodiscard]] constexpr reference       operator[](size_type i)       noexcept { assert(i < m_size); return { this, i }; }
+        [[nodiscard]] constexpr const_reference operator[](size_type i) const noexcept { assert(i < m_size); return { this, i }; }
+
+        // Appends empty sets, or drops sets from the back.
+        constexpr void resize(size_type n)
+        {
+                m_blocks.resize(num_tiles(n) * tile_blocks);
+                for (auto i = std::exchange(m_size, n); i < n; ++i) {
+                        (*this)[i].clear();
+                }
+        }
+
+        constexpr void push_back(value_type const& s)
+        {
+                if (m_size % tile_size == 0) {
+                        m_blocks.resize(m_blocks.size() + tile_blocks);
+                }
+                (*this)[m_size++] = s;
+        }
+
+        constexpr void clear() noexcept
+        {
+                m_blocks.clear();
+                m_size = 0;
+        }
+
+        // Applies a mask to every set.
+        constexpr bit_set_array& operator&=(value_type const& mask) noexcept { transform(mask, [](Block s, Block m) { return static_cast<Block>(s &  m); }); return *this; }
+        constexpr bit_set_array& operator|=(value_type const& mask) noexcept { transform(mask, [](Block s, Block m) { return static_cast<Block>(s |  m); }); return *this; }
+        constexpr bit_set_array& operator^=(value_type const& mask) noexcept { transform(mask, [](Block s, Block m) { return static_cast<Block>(s ^  m); }); return *this; }
+        constexpr bit_set_array& operator-=(value_type const& mask) noexcept { transform(mask, [](Block s, Block m) { return static_cast<Block>(s & ~m); }); return *this; }
+
+        // The cardinalities of all sets.
+        [[nodiscard]] constexpr std::vector<size_type> counts() const
+        {
+                auto result = std::vector<size_type>(num_tiles(m_size) * tile_size);
+                for (auto t : std::views::iota(0uz, num_tiles(m_size))) {
+                        auto const out = result.data() + t * tile_size;
+                        for (auto b : std::views::iota(0uz, num_blocks)) {
+                                auto const plane = m_blocks.data() + t * tile_blocks + b * tile_size;
+                                for (auto lane : std::views::iota(0uz, tile_size)) {
+                                        out[lane] += bit::popcount(plane[lane]);
+                                }
+                        }
+                }
+                result.resize(m_size);
+                return result;
+        }
+
+        // The indices of the sets that are a subset of, a superset of, or
+        // intersect the mask, in increasing order.
+        [[nodiscard]] constexpr std::vector<size_type> subsets_of  (value_type const& mask) const { return select(mask, [](Block s, Block m) { return static_cast<Block>(s & ~m); }, false); }
+        [[nodiscard]] constexpr std::vector<size_type> supersets_of(value_type const& mask) const { return select(mask, [](Block s, Block m) { return static_cast<Block>(m & ~s); }, false); }
+        [[nodiscard]] constexpr std::vector<size_type> intersecting(value_type const& mask) const { return select(mask, [](Block s, Block m) { return static_cast<Block>(s &  m); }, true);  }
+};
+
+}       // namespace xstd
+
+#endif  // include guard
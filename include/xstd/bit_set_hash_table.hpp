@@ -0,0 +1,470 @@
+#ifndef XSTD_BIT_SET_HASH_TABLE_HPP
+#define XSTD_BIT_SET_HASH_TABLE_HPP
+
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit/hash.hpp>    // hash
+#include <xstd/bit/intrin.hpp>  // countr_zero
+#include <xstd/bit_set.hpp>     // bit_set
+#include <algorithm>            // fill, max
+#include <bit>                  // bit_ceil
+#include <concepts>             // default_initializable, unsigned_integral
+#include <cstddef>              // ptrdiff_t, size_t
+#include <cstdint>              // int8_t, uint32_t, uint64_t
+#include <iterator>             // forward_iterator_tag
+#include <type_traits>          // conditional_t, is_void_v
+#include <utility>              // exchange, forward, move, pair, swap
+#include <vector>               // vector
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define XSTD_SWISS_HAS_SSE2
+        #include <emmintrin.h>  // _mm_cmpeq_epi8, _mm_cmpgt_epi8, _mm_loadu_si128, _mm_movemask_epi8, _mm_set1_epi8
+#endif
+
+// Open-addressing hash sets and maps of bit_sets in the layout of Swiss tables
+// (Abseil's flat_hash_map): the slots are split into groups of 16, and every
+// slot has a control byte that is either empty, deleted (a tombstone), or the
+// low 7 bits of the hash of its key. A lookup probes whole groups, comparing
+// all 16 control bytes against the 7-bit fingerprint at once (with SSE2 where
+// available), and only compares the keys of the few matching slots, block by
+// block. The keys, the control bytes and the mapped values live in separate
+// arrays, so that probing touches neither the values nor the keys of
+// non-matching slots, and every key is stored inline, without the per-node
+// allocation of std::unordered_set.
+
+namespace xstd {
+namespace swiss {
+
+inline constexpr auto group_size = 16uz;
+
+inline constexpr std::int8_t ctrl_empty   = -128;
+inline constexpr std::int8_t ctrl_deleted = -2;
+
+// The 16 control bytes of a group, matched against a value into a bitmask
+// with bit i set for slot i.
+class group
+{
+#if defined(XSTD_SWISS_HAS_SSE2)
+        __m128i m_ctrl;
+#else
+        std::int8_t const* m_ctrl;
+#endif
+
+        template<class UnaryPredicate>
+        [[nodiscard]] std::uint32_t match_if([[maybe_unused]] UnaryPredicate pred) const noexcept
+        {
+                auto nrv = std::uint32_t{0};
+#if !defined(XSTD_SWISS_HAS_SSE2)
+                for (auto i = 0uz; i < group_size; ++i) {
+                        nrv |= static_cast<std::uint32_t>(pred(m_ctrl[i])) << i;
+                }
+#endif
+                return nrv;
+        }
+
+public:
+        explicit group(std::int8_t const* ctrl) noexcept
+        :
+#if defined(XSTD_SWISS_HAS_SSE2)
+                m_ctrl(_mm_loadu_si128(reinterpret_cast<__m128i const*>(ctrl)))
+#else
+                m_ctrl(ctrl)
+#endif
+        {}
+
+        [[nodiscard]] std::uint32_t match(std::int8_t h2) const noexcept
+        {
+#if defined(XSTD_SWISS_HAS_SSE2)
+                return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_ctrl)));
+#else
+                return match_if([=](std::int8_t c) { return c == h2; });
+#endif
+        }
+
+        [[nodiscard]] std::uint32_t match_empty() const noexcept
+        {
+                return match(ctrl_empty);
+        }
+
+        [[nodiscard]] std::uint32_t match_empty_or_deleted() const noexcept
+        {
+#if defined(XSTD_SWISS_HAS_SSE2)
+                return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), m_ctrl)));
+#else
+                return match_if([](std::int8_t c) { return c < -1; });
+#endif
+        }
+};
+
+// The table shared by bit_set_hash_set (Mapped = void) and bit_set_hash_map.
+// The capacity is zero or a power of two of at least group_size, of which
+// at most 7/8 is filled (including tombstones), so that every probe
+// sequence ends at an empty slot. The groups are probed in triangular
+// order, which visits all of them for a power-of-two number of groups.
+template<std::size_t N, std::unsigned_integral Block, class Mapped>
+class table
+{
+public:
+        using key_type  = bit_set<N, Block>;
+        using size_type = std::size_t;
+
+protected:
+        static constexpr auto is_set = std::is_void_v<Mapped>;
+        static constexpr auto npos   = static_cast<size_type>(-1);
+
+        struct no_values {};
+        using mapped_or_char = std::conditional_t<is_set, char, Mapped>;
+        using values_type    = std::conditional_t<is_set, no_values, std::vector<mapped_or_char>>;
+
+        std::vector<std::int8_t> m_ctrl;
+        std::vector<key_type> m_keys;
+        [[no_unique_address]] values_type m_values;
+        size_type m_size = 0;
+        size_type m_growth_left = 0;
+
+        [[nodiscard]] static std::uint64_t hash(key_type const& key) noexcept
+        {
+                return bit::hash(blocks(key));
+        }
+
+        [[nodiscard]] static std::int8_t h2(std::uint64_t h) noexcept
+        {
+                return static_cast<std::int8_t>(h & 0x7F);
+        }
+
+        [[nodiscard]] static size_type max_load(size_type capacity) noexcept
+        {
+                return capacity - capacity / 8;
+        }
+
+        [[nodiscard]] size_type num_groups() const noexcept
+        {
+                return m_ctrl.size() / group_size;
+        }
+
+        // The slot of key, or npos.
+        [[nodiscard]] size_type find_index(key_type const& key, std::uint64_t h) const noexcept
+        {
+                if (m_ctrl.empty()) {
+                        return npos;
+                }
+                auto const mask = num_groups() - 1;
+                for (auto g = static_cast<size_type>(h >> 7) & mask, step = 0uz; ; g = (g + ++step) & mask) {
+                        auto const grp = group(m_ctrl.data() + g * group_size);
+                        for (auto m = grp.match(h2(h)); m != 0; m &= m - 1) {
+                                if (auto const i = g * group_size + bit::countr_zero(m); m_keys[i] == key) {
+                                        return i;
+                                }
+                        }
+                        if (grp.match_empty() != 0) {
+                                return npos;
+                        }
+                }
+        }
+
+        // The first empty or deleted slot on the probe sequence of h.
+        [[nodiscard]] size_type find_first_non_full(std::uint64_t h) const noexcept
+        {
+                auto const mask = num_groups() - 1;
+                for (auto g = static_cast<size_type>(h >> 7) & mask, step = 0uz; ; g = (g + ++step) & mask) {
+                        if (auto const m = group(m_ctrl.data() + g * group_size).match_empty_or_deleted(); m != 0) {
+                                return g * group_size + bit::countr_zero(m);
+                        }
+                }
+        }
+
+        // Moves all keys (and values) into a table of the given capacity.
+        void rehash(size_type capacity)
+        {
+                auto ctrl = std::exchange(m_ctrl, std::vector<std::int8_t>(capacity, ctrl_empty));
+                auto keys = std::exchange(m_keys, std::vector<key_type>(capacity));
+                auto values = std::exchange(m_values, values_type());
+                if constexpr (not is_set) {
+                        m_values.resize(capacity);
+                }
+                m_growth_left = max_load(capacity) - m_size;
+                for (auto i = 0uz; i < ctrl.size(); ++i) {
+                        if (ctrl[i] >= 0) {
+                                auto const h = hash(keys[i]);
+                                auto const j = find_first_non_full(h);
+                                m_ctrl[j] = h2(h);
+                                m_keys[j] = keys[i];
+                                if constexpr (not is_set) {
+                                        m_values[j] = std::move(values[i]);
+                                }
+                        }
+                }
+        }
+
+        // The slot of key, inserted if absent, and whether it was inserted.
+        std::pair<size_type, bool> find_or_prepare_insert(key_type const& key)
+        {
+                auto const h = hash(key);
+                if (auto const i = find_index(key, h); i != npos) {
+                        return { i, false };
+                }
+                if (m_ctrl.empty()) {
+                        rehash(group_size);
+                }
+                auto i = find_first_non_full(h);
+                if (m_growth_left == 0 and m_ctrl[i] != ctrl_deleted) {
+                        // Many tombstones: clean them up in place. Otherwise grow.
+                        rehash(m_size + 1 <= max_load(m_ctrl.size()) / 2 ? m_ctrl.size() : 2 * m_ctrl.size());
+                        i = find_first_non_full(h);
+                }
+                if (m_ctrl[i] == ctrl_empty) {
+                        --m_growth_left;
+                }
+                m_ctrl[i] = h2(h);
+                m_keys[i] = key;
+                ++m_size;
+                return { i, true };
+        }
+
+        void erase_index(size_type i) noexcept
+        {
+                // A slot in a group with an empty slot can become empty again:
+                // every probe sequence through this group stops here anyway.
+                if (group(m_ctrl.data() + i / group_size * group_size).match_empty() != 0) {
+                        m_ctrl[i] = ctrl_empty;
+                        ++m_growth_left;
+                } else {
+                        m_ctrl[i] = ctrl_deleted;
+                }
+                if constexpr (not is_set) {
+                        m_values[i] = Mapped();
+                }
+                --m_size;
+        }
+
+        template<bool Const>
+        class iterator_type
+        {
+                friend table;
+                template<bool> friend class iterator_type;
+                using table_pointer = std::conditional_t<Const, table const*, table*>;
+
+                table_pointer m_table = nullptr;
+                size_type m_index = 0;
+
+                constexpr iterator_type(table_pointer t, size_type i) noexcept
+                :
+                        m_table(t),
+                        m_index(i)
+                {
+                        skip();
+                }
+
+                constexpr void skip() noexcept
+                {
+                        while (m_index < m_table->m_ctrl.size() and m_table->m_ctrl[m_index] < 0) {
+                                ++m_index;
+                        }
+                }
+
+        public:
+                using iterator_concept = std::forward_iterator_tag;
+                using difference_type  = std::ptrdiff_t;
+                using value_type       = std::conditional_t<is_set, key_type, std::pair<key_type, mapped_or_char>>;
+
+                constexpr iterator_type() noexcept = default;
+
+                // Copies a mutable iterator to a const one.
+                template<bool OtherConst> requires (Const and not OtherConst)
+                constexpr iterator_type(iterator_type<OtherConst> const& other) noexcept
+                :
+                        m_table(other.m_table),
+                        m_index(other.m_index)
+                {}
+
+                // The key for sets, and a pair of references to the key and
+                // the value for maps.
+                [[nodiscard]] constexpr decltype(auto) operator*() const noexcept
+                {
+                        if constexpr (is_set) {
+                                return static_cast<key_type const&>(m_table->m_keys[m_index]);
+                        } else {
+                                using mapped_reference = std::conditional_t<Const, Mapped const&, Mapped&>;
+                                return std::pair<key_type const&, mapped_reference>(m_table->m_keys[m_index], m_table->m_values[m_index]);
+                        }
+                }
+
+                constexpr iterator_type& operator++() noexcept
+                {
+                        ++m_index;
+                        skip();
+                        return *this;
+                }
+
+                constexpr iterator_type operator++(int) noexcept
+                {
+                        auto nrv = *this;
+                        ++*this;
+                        return nrv;
+                }
+
+                [[nodiscard]] friend constexpr bool operator==(iterator_type const& x, iterator_type const& y) noexcept
+                {
+                        return x.m_index == y.m_index;
+                }
+        };
+
+public:
+        using iterator       = iterator_type<is_set>;
+        using const_iterator = iterator_type<true>;
+
+        [[nodiscard]] iterator       begin()       noexcept { return { this, 0 }; }
+        [[nodiscard]] const_iterator begin() const noexcept { return { this, 0 }; }
+        [[nodiscard]] iterator       end()         noexcept { return { this, m_ctrl.size() }; }
+        [[nodiscard]] const_iterator end()   const noexcept { return { this, m_ctrl.size() }; }
+
+        [[nodiscard]] size_type size()     const noexcept { return m_size;          }
+        [[nodiscard]] bool      empty()    const noexcept { return m_size == 0;     }
+        [[nodiscard]] size_type capacity() const noexcept { return m_ctrl.size();   }
+
+        [[nodiscard]] iterator find(key_type const& key) noexcept
+        {
+                auto const i = find_index(key, hash(key));
+                return i == npos ? end() : iterator(this, i);
+        }
+
+        [[nodiscard]] const_iterator find(key_type const& key) const noexcept
+        {
+                auto const i = find_index(key, hash(key));
+                return i == npos ? end() : const_iterator(this, i);
+        }
+
+        [[nodiscard]] bool contains(key_type const& key) const noexcept
+        {
+                return find_index(key, hash(key)) != npos;
+        }
+
+        [[nodiscard]] size_type count(key_type const& key) const noexcept
+        {
+                return contains(key);
+        }
+
+        size_type erase(key_type const& key) noexcept
+        {
+                if (auto const i = find_index(key, hash(key)); i != npos) {
+                        erase_index(i);
+                        return 1;
+                }
+                return 0;
+        }
+
+        // Keeps the capacity.
+        void clear() noexcept
+        {
+                std::ranges::fill(m_ctrl, ctrl_empty);
+                if constexpr (not is_set) {
+                        std::ranges::fill(m_values, Mapped());
+                }
+                m_size = 0;
+                m_growth_left = max_load(m_ctrl.size());
+        }
+
+        // Makes room for n keys without further rehashing.
+        void reserve(size_type n)
+        {
+                if (n > m_size + m_growth_left) {
+                        auto capacity = std::max(std::bit_ceil(n), group_size);
+                        while (max_load(capacity) < n) {
+                                capacity *= 2;
+                        }
+                        rehash(capacity);
+                }
+        }
+
+        void swap(table& other) noexcept
+        {
+                std::swap(*this, other);
+        }
+
+protected:
+        [[nodiscard]] iterator iterator_at(size_type i) noexcept
+        {
+                return { this, i };
+        }
+};
+
+}       // namespace swiss
+
+// A hash set of bit_set<N, Block>.
+template<std::size_t N, std::unsigned_integral Block = std::size_t>
+class bit_set_hash_set
+:
+        public swiss::table<N, Block, void>
+{
+        using base = swiss::table<N, Block, void>;
+
+public:
+        using typename base::key_type;
+        using value_type = key_type;
+
+        // Inserts key if absent, and returns the position of key and
+        // whether it was inserted.
+        std::pair<typename base::iterator, bool> insert(key_type const& key)
+        {
+                auto const [ i, inserted ] = this->find_or_prepare_insert(key);
+                return { this->iterator_at(i), inserted };
+        }
+
+        [[nodiscard]] friend bool operator==(bit_set_hash_set const& x, bit_set_hash_set const& y) noexcept
+        {
+                if (x.size() != y.size()) {
+                        return false;
+                }
+                for (auto const& key : x) {
+                        if (not y.contains(key)) {
+                                return false;
+                        }
+                }
+                return true;
+        }
+};
+
+// A hash map from bit_set<N, Block> to default-initializable values, which
+// are iterated as pairs of references to the key and the value.
+template<std::size_t N, std::default_initializable T, std::unsigned_integral Block = std::size_t>
+class bit_set_hash_map
+:
+        public swiss::table<N, Block, T>
+{
+        using base = swiss::table<N, Block, T>;
+
+public:
+        using typename base::key_type;
+        using mapped_type = T;
+
+        // Inserts key with the value constructed from args if absent, and
+        // returns the position of key and whether it was inserted.
+        template<class... Args>
+        std::pair<typename base::iterator, bool> try_emplace(key_type const& key, Args&&... args)
+        {
+                auto const [ i, inserted ] = this->find_or_prepare_insert(key);
+                if (inserted) {
+                        this->m_values[i] = mapped_type(std::forward<Args>(args)...);
+                }
+                return { this->iterator_at(i), inserted };
+        }
+
+        std::pair<typename base::iterator, bool> insert_or_assign(key_type const& key, mapped_type value)
+        {
+                auto const [ i, inserted ] = this->find_or_prepare_insert(key);
+                this->m_values[i] = std::move(value);
+                return { this->iterator_at(i), inserted };
+        }
+
+        [[nodiscard]] mapped_type& operator[](key_type const& key)
+        {
+                return this->m_values[this->find_or_prepare_insert(key).first];
+        }
+};
+
+}       // namespace xstd
+
+#endif  // include guard
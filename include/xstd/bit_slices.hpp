@@ -0,0 +1,124 @@
+#ifndef XSTD_BIT_SLICES_HPP
+#define XSTD_BIT_SLICES_HPP
+
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit/transpose.hpp>       // square_matrix, transpose
+#include <xstd/bit_set.hpp>             // bit_set
+#include <array>                        // array
+#include <cassert>                      // assert
+#include <concepts>                     // unsigned_integral
+#include <cstddef>                      // size_t
+#include <initializer_list>             // initializer_list
+#include <ranges>                       // iota
+#include <span>                         // span
+
+namespace xstd {
+
+// The vertical (bit-sliced) layout of up to Count bit_set<N>: for every
+// element i, a bit_set<Count> over the set ids with bit s set if set s
+// contains i. Which of the sets contain a given element is then a single
+// lookup instead of one random access per set, and which contain all (or
+// any) of a few elements is a handful of ANDs (or ORs) of slices.
+//
+// The layout is built by transposing square tiles of bits_per_block sets
+// times bits_per_block elements, one block of each set per tile, with the
+// recursive block transposition of bit::transpose.
+template<std::size_t N, std::size_t Count, std::unsigned_integral Block = std::size_t>
+class bit_slices
+{
+public:
+        using set_type   = bit_set<N, Block>;
+        using slice_type = bit_set<Count, Block>;
+
+private:
+        static constexpr auto bits_per_block = set_type::bits_per_block;
+        static constexpr auto set_blocks     = set_type::num_blocks;
+
+        std::array<slice_type, N> m_slices{};
+        slice_type m_all{};                     // the ids of the stored sets, 0 up to size()
+
+public:
+        constexpr bit_slices() = default;
+
+        // Transposes sets, of which there can be at most Count.
+        constexpr explicit bit_slices(std::span<set_type const> sets) noexcept
+        {
+                assert(sets.size() <= Count);
+                auto tile = bit::square_matrix<Block>();
+                for (auto t : std::views::iota(0uz, (sets.size() + bits_per_block - 1) / bits_per_block)) {
+                        for (auto e : std::views::iota(0uz, set_blocks)) {
+                                for (auto r : std::views::iota(0uz, bits_per_block)) {
+                                        auto const s = t * bits_per_block + r;
+                                        tile[r] = s < sets.size() ? blocks(sets[s])[e] : static_cast<Block>(0);
+                                }
+                                bit::transpose(tile);
+                                for (auto c : std::views::iota(0uz, bits_per_block)) {
+                                        if (auto const i = e * bits_per_block + c; i < N) {
+                                                set_block(m_slices[i], t, tile[c]);
+                                        }
+                                }
+                        }
+                }
+                for (auto s : std::views::iota(0uz, sets.size())) {
+                        m_all.insert(s);
+                }
+        }
+
+        // The number of stored sets.
+        [[nodiscard]] constexpr auto size() const noexcept { return m_all.size(); }
+
+        // The ids of the sets containing element i.
+        [[nodiscard]] constexpr slice_type const& operator[](std::size_t i) const noexcept
+        {
+                assert(i < N);
+                return m_slices[i];
+        }
+
+        // The ids of the sets containing every one of the elements.
+        [[nodiscard]] constexpr slice_type containing_all(std::initializer_list<std::size_t> elements) const noexcept
+        {
+                auto nrv = m_all;
+                for (auto i : elements) {
+                        nrv &= (*this)[i];
+                }
+                return nrv;
+        }
+
+        // The ids of the sets containing any of the elements.
+        [[nodiscard]] constexpr slice_type containing_any(std::initializer_list<std::size_t> elements) const noexcept
+        {
+                auto nrv = slice_type();
+                for (auto i : elements) {
+                        nrv |= (*this)[i];
+                }
+                return nrv;
+        }
+
+        // The ids of the supersets of q.
+        [[nodiscard]] constexpr slice_type containing_all(set_type const& q) const noexcept
+        {
+                auto nrv = m_all;
+                for (auto i : q) {
+                        nrv &= m_slices[i];
+                }
+                return nrv;
+        }
+
+        // The ids of the sets intersecting q.
+        [[nodiscard]] constexpr slice_type containing_any(set_type const& q) const noexcept
+        {
+                auto nrv = slice_type();
+                for (auto i : q) {
+                        nrv |= m_slices[i];
+                }
+                return nrv;
+        }
+};
+
+}       // namespace xstd
+
+#endif  // include guard
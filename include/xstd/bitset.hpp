@@ -30,10 +30,10 @@ template<class charT, class traits, std::size_t N, std::unsigned_integral Block>
 }       // namespace xstd
 
 #include <xstd/bit/array.hpp>           // array
+#include <xstd/bit/hash.hpp>            // hash
 #include <xstd/proxy/bidirectional.hpp> // find
-#include <boost/hash2/fnv1a.hpp>        // fnv1a_64
 #include <boost/hash2/hash_append.hpp>  // hash_append
-#include <algorithm>                    // lexicographical_compare_three_way
+#include <algorithm>                    // min
 #include <cassert>                      // assert
 #include <compare>                      // strong_ordering
 #include <format>                       // format
@@ -43,6 +43,7 @@ template<class charT, class traits, std::size_t N, std::unsigned_integral Block>
 #include <memory>                       // allocator
 #include <ranges>                       // find_if, iota, reverse
 #include <source_location>              // source_location
+#include <span>                         // span
 #include <string_view>                  // basic_string_view
 #include <stdexcept>                    // invalid_argument, out_of_range, overflow_error
 
@@ -65,6 +66,9 @@ class bitset
         // side on which one is "the" ordering.
         bit::array<N, Block> m_bits{};
 
+        friend struct proxy::bidirectional::compare<bitset>;
+        friend struct std::hash<bitset>;
+
         template<class Provider, class Hash, class Flavor>
         friend constexpr void tag_invoke(boost::hash2::hash_append_tag const&, Provider const&, Hash& h, Flavor const& f, bitset const* v) noexcept
         {
@@ -155,6 +159,12 @@ public:
         constexpr bitset& operator<<=(std::size_t pos) noexcept { if (pos < N) { m_bits <<= pos; } else { m_bits.reset(); } return *this; }
         constexpr bitset& operator>>=(std::size_t pos) noexcept { if (pos < N) { m_bits >>= pos; } else { m_bits.reset(); } return *this; }
 
+        // extensions: rotations modulo N, and mirroring pos to N - 1 - pos
+        constexpr bitset& rotl    (std::size_t pos) noexcept                       { m_bits.rotl(pos);   return *this; }
+        constexpr bitset& rotr    (std::size_t pos) noexcept                       { m_bits.rotr(pos);   return *this; }
+        constexpr bitset& reverse ()                noexcept                       { m_bits.reverse();   return *this; }
+        constexpr bitset& byteswap()                noexcept requires (N % 8 == 0) { m_bits.byteswap();  return *this; }
+
         [[nodiscard]] constexpr bitset operator<<(std::size_t pos) const noexcept { auto nrv = *this; nrv <<= pos; return nrv; }
         [[nodiscard]] constexpr bitset operator>>(std::size_t pos) const noexcept { auto nrv = *this; nrv >>= pos; return nrv; }
 
@@ -292,19 +302,19 @@ struct find<xstd::bitset<N, Block>>
 
 // xstd::bitset has no <=> of its own either (by the same design choice), so
 // compare<Bits>'s default (trust Bits' own <=>) doesn't apply - opt in to
-// the safe, iteration-based ordering explicitly, same as std::bitset<N> and
-// boost::dynamic_bitset<> do in their own headers.
+// the std::set<int>-equivalent ordering explicitly, same as std::bitset<N>
+// and boost::dynamic_bitset<> do in their own headers. Unlike find<> above,
+// this does read m_bits directly (as a friend), for bit::array's word-
+// parallel set_three_way: the opt-ins for std::bitset<N> and boost::
+// dynamic_bitset<> decide the order at the first differing word too, from
+// their own XOR and find-first-set where they have one, so this gives
+// xstd::bitset no advantage std::bitset itself couldn't also get.
 template<std::size_t N, std::unsigned_integral Block>
 struct compare<xstd::bitset<N, Block>>
 {
         [[nodiscard]] static constexpr std::strong_ordering lexicographical_three_way(xstd::bitset<N, Block> const& x, xstd::bitset<N, Block> const& y) noexcept
         {
-                auto const xv = view(x);
-                auto const yv = view(y);
-                return std::lexicographical_compare_three_way(
-                        xv.begin(), xv.end(),
-                        yv.begin(), yv.end()
-                );
+                return x.m_bits.set_three_way(y.m_bits);
         }
 };
 
@@ -325,14 +335,16 @@ namespace std {
 // partial specialization of std::hash for a user type is explicitly
 // sanctioned by the standard either way - only the primary template's own
 // declaration is off-limits to add ourselves.
+//
+// The blocks are mixed a 64-bit word at a time by xstd::bit::hash, not
+// streamed bytewise through Boost.Hash2's FNV-1a. Hash2 users who want a
+// particular algorithm still get the blocks through tag_invoke above.
 template<size_t N, unsigned_integral Block>
 struct hash<xstd::bitset<N, Block>>
 {
         [[nodiscard]] constexpr std::size_t operator()(xstd::bitset<N, Block> const& v) const noexcept
         {
-                boost::hash2::fnv1a_64 h;
-                boost::hash2::hash_append(h, {}, v);
-                return boost::hash2::get_integral_result<std::size_t>(h);
+                return static_cast<std::size_t>(xstd::bit::hash(std::span(v.m_bits.m_bits)));
         }
 };
 
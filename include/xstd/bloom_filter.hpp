@@ -0,0 +1,304 @@
+#ifndef XSTD_BLOOM_FILTER_HPP
+#define XSTD_BLOOM_FILTER_HPP
+
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit/array.hpp>   // array
+#include <xstd/bit/hash.hpp>    // mix, splitmix64
+#include <algorithm>            // min
+#include <array>                // array
+#include <bit>                  // countr_zero
+#include <concepts>             // unsigned_integral
+#include <cstddef>              // size_t
+#include <cstdint>              // uint64_t
+#include <ranges>               // iota
+#include <span>                 // span
+#include <utility>              // pair
+
+// Bloom filters over 64-bit hashes of the keys (e.g. from Boost.Hash2), with
+// all bits stored inline in bit::arrays: no allocation, and every operation
+// is constexpr. The batched insert_many and contains_many first prefetch the
+// blocks of a whole batch of hashes and only then touch them, so that the
+// cache misses of the batch overlap instead of following each other.
+
+namespace xstd {
+namespace bloom {
+
+// Lemire's multiply-shift range reduction of h to [0, n), from its high bits.
+[[nodiscard]] constexpr std::size_t reduce(std::uint64_t h, std::size_t n) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+        return static_cast<std::size_t>((static_cast<__uint128_t>(h) * n) >> 64);
+#else
+        return static_cast<std::size_t>(h % n);
+#endif
+}
+
+inline constexpr auto batch_size = 16uz;
+
+constexpr void prefetch([[maybe_unused]] void const* p) noexcept
+{
+        if not consteval {
+#if defined(__GNUC__) || defined(__clang__)
+                __builtin_prefetch(p);
+#endif
+        }
+}
+
+}       // namespace bloom
+
+// The classic filter: K probes anywhere in Bits bits, at the positions
+// h1 + i * h2 of Kirsch-Mitzenmacher double hashing.
+template<std::size_t Bits, std::size_t K, std::unsigned_integral Block = std::size_t>
+class bloom_filter
+{
+        static_assert(Bits > 0 and K > 0);
+
+        using array_type = bit::array<Bits, Block>;
+
+        static constexpr auto bits_per_block = array_type::bits_per_block;
+
+        array_type m_bits{};
+
+        template<class UnaryFunction>
+        static constexpr void for_each_probe(std::uint64_t hash, UnaryFunction f) noexcept
+        {
+                auto const step = bit::mix(hash) | 1;
+                for ([[maybe_unused]] auto _ : std::views::iota(0uz, K)) {
+                        f(bloom::reduce(hash, Bits));
+                        hash += step;
+                }
+        }
+
+public:
+        static constexpr auto num_bits   = Bits;
+        static constexpr auto num_probes = K;
+
+        [[nodiscard]] constexpr bool operator==(bloom_filter const&) const noexcept = default;
+
+        constexpr void insert(std::uint64_t hash) noexcept
+        {
+                for_each_probe(hash, [&](auto n) {
+                        m_bits.set(n);
+                });
+        }
+
+        [[nodiscard]] constexpr bool contains(std::uint64_t hash) const noexcept
+        {
+                auto found = true;
+                for_each_probe(hash, [&](auto n) {
+                        found = found and m_bits[n];
+                });
+                return found;
+        }
+
+        constexpr void insert_many(std::span<std::uint64_t const> hashes) noexcept
+        {
+                for (auto first = 0uz; first < hashes.size(); first += bloom::batch_size) {
+                        auto const batch = hashes.subspan(first, std::min(bloom::batch_size, hashes.size() - first));
+                        for (auto hash : batch) {
+                                prefetch_probes(hash);
+                        }
+                        for (auto hash : batch) {
+                                insert(hash);
+                        }
+                }
+        }
+
+        template<class OutputIterator>
+        constexpr OutputIterator contains_many(std::span<std::uint64_t const> hashes, OutputIterator out) const noexcept
+        {
+                for (auto first = 0uz; first < hashes.size(); first += bloom::batch_size) {
+                        auto const batch = hashes.subspan(first, std::min(bloom::batch_size, hashes.size() - first));
+                        for (auto hash : batch) {
+                                prefetch_probes(hash);
+                        }
+                        for (auto hash : batch) {
+                                *out++ = contains(hash);
+                        }
+                }
+                return out;
+        }
+
+        // The number of set bits, e.g. to estimate the number of insertions
+        // as -Bits / K * log(1 - count() / Bits).
+        [[nodiscard]] constexpr auto count() const noexcept { return m_bits.count(); }
+        [[nodiscard]] constexpr bool empty() const noexcept { return m_bits.none(); }
+        constexpr void clear() noexcept { m_bits.reset(); }
+
+        // The union and the (over-approximated) intersection of two filters
+        // of the same shape.
+        constexpr bloom_filter& operator|=(bloom_filter const& other) noexcept { m_bits |= other.m_bits; return *this; }
+        constexpr bloom_filter& operator&=(bloom_filter const& other) noexcept { m_bits &= other.m_bits; return *this; }
+
+        [[nodiscard]] friend constexpr bloom_filter operator|(bloom_filter const& lhs, bloom_filter const& rhs) noexcept { auto nrv = lhs; nrv |= rhs; return nrv; }
+        [[nodiscard]] friend constexpr bloom_filter operator&(bloom_filter const& lhs, bloom_filter const& rhs) noexcept { auto nrv = lhs; nrv &= rhs; return nrv; }
+
+private:
+        constexpr void prefetch_probes(std::uint64_t hash) const noexcept
+        {
+                if not consteval {
+                        for_each_probe(hash, [&](auto n) {
+                                bloom::prefetch(&m_bits.m_bits[n / bits_per_block]);
+                        });
+                }
+        }
+};
+
+// The cache-blocked filter (Putze, Sanders and Singler): the hash selects one
+// 512-bit line, aligned to a 64-byte cache line, and all K probes fall into
+// it. A query builds the probe mask and tests it against the line with a
+// single is_subset_of, an AND-compare over 512 bits that vectorizes. This
+// trades a slightly higher false positive rate for one cache miss per query.
+template<std::size_t Bits, std::size_t K, std::unsigned_integral Block = std::uint64_t>
+class blocked_bloom_filter
+{
+        static_assert(Bits > 0 and K > 0);
+
+public:
+        static constexpr auto line_bits = 512uz;
+
+private:
+        using line_type = bit::array<line_bits, Block>;
+
+        struct alignas(64) line
+        {
+                line_type bits{};
+                [[nodiscard]] constexpr bool operator==(line const&) const noexcept = default;
+        };
+
+        static constexpr auto num_lines = (Bits + line_bits - 1) / line_bits;
+
+        std::array<line, num_lines> m_lines{};
+
+        static constexpr auto bits_per_block = line_type::bits_per_block;
+        static constexpr auto words_per_line = line_type::num_blocks;
+
+        // One odd multiplier per probe, from the splitmix64 sequence.
+        static constexpr auto salts = []() {
+                auto nrv = std::array<std::uint64_t, K>();
+                auto state = std::uint64_t{0};
+                for (auto& salt : nrv) {
+                        salt = bit::splitmix64(state) | 1;
+                }
+                return nrv;
+        }();
+
+        // The line from the high bits of the hash, and probe i in block
+        // i % words_per_line of the mask (split block Bloom filter), at the
+        // bit given by the high bits of the mixed hash times the i-th salt.
+        // The mask is built with compile-time block indices only, and then
+        // rotated by a hashed number of whole blocks, so that every block of
+        // the line gets probed even for K < words_per_line.
+        [[nodiscard]] static constexpr auto probe(std::uint64_t hash) noexcept
+        {
+                constexpr auto shift = 64 - std::countr_zero(bits_per_block);
+                auto const h2 = bit::mix(hash);
+                auto mask = line_type();
+                for (auto i : std::views::iota(0uz, K)) {
+                        mask.m_bits[i % words_per_line] |= static_cast<Block>(static_cast<Block>(1) << ((h2 * salts[i]) >> shift));
+                }
+                if constexpr (K < words_per_line) {
+                        mask.rotl(static_cast<std::size_t>(h2 % words_per_line) * bits_per_block);
+                }
+                return std::pair{ bloom::reduce(hash, num_lines), mask };
+        }
+
+public:
+        static constexpr auto num_bits   = num_lines * line_bits;
+        static constexpr auto num_probes = K;
+
+        [[nodiscard]] constexpr bool operator==(blocked_bloom_filter const&) const noexcept = default;
+
+        constexpr void insert(std::uint64_t hash) noexcept
+        {
+                auto const [ n, mask ] = probe(hash);
+                m_lines[n].bits |= mask;
+        }
+
+        [[nodiscard]] constexpr bool contains(std::uint64_t hash) const noexcept
+        {
+                auto const [ n, mask ] = probe(hash);
+                return mask.is_subset_of(m_lines[n].bits);
+        }
+
+        constexpr void insert_many(std::span<std::uint64_t const> hashes) noexcept
+        {
+                for (auto first = 0uz; first < hashes.size(); first += bloom::batch_size) {
+                        auto const batch = hashes.subspan(first, std::min(bloom::batch_size, hashes.size() - first));
+                        for (auto hash : batch) {
+                                bloom::prefetch(&m_lines[bloom::reduce(hash, num_lines)]);
+                        }
+                        for (auto hash : batch) {
+                                insert(hash);
+                        }
+                }
+        }
+
+        template<class OutputIterator>
+        constexpr OutputIterator contains_many(std::span<std::uint64_t const> hashes, OutputIterator out) const noexcept
+        {
+                for (auto first = 0uz; first < hashes.size(); first += bloom::batch_size) {
+                        auto const batch = hashes.subspan(first, std::min(bloom::batch_size, hashes.size() - first));
+                        for (auto hash : batch) {
+                                bloom::prefetch(&m_lines[bloom::reduce(hash, num_lines)]);
+                        }
+                        for (auto hash : batch) {
+                                *out++ = contains(hash);
+                        }
+                }
+                return out;
+        }
+
+        [[nodiscard]] constexpr auto count() const noexcept
+        {
+                auto sum = 0uz;
+                for (auto const& l : m_lines) {
+                        sum += l.bits.count();
+                }
+                return sum;
+        }
+
+        [[nodiscard]] constexpr bool empty() const noexcept
+        {
+                for (auto const& l : m_lines) {
+                        if (not l.bits.none()) {
+                                return false;
+                        }
+                }
+                return true;
+        }
+
+        constexpr void clear() noexcept
+        {
+                for (auto& l : m_lines) {
+                        l.bits.reset();
+                }
+        }
+
+        constexpr blocked_bloom_filter& operator|=(blocked_bloom_filter const& other) noexcept
+        {
+                for (auto i : std::views::iota(0uz, num_lines)) {
+                        m_lines[i].bits |= other.m_lines[i].bits;
+                }
+                return *this;
+        }
+
+        constexpr blocked_bloom_filter& operator&=(blocked_bloom_filter const& other) noexcept
+        {
+                for (auto i : std::views::iota(0uz, num_lines)) {
+                        m_lines[i].bits &= other.m_lines[i].bits;
+                }
+                return *this;
+        }
+
+        [[nodiscard]] friend constexpr blocked_bloom_filter operator|(blocked_bloom_filter const& lhs, blocked_bloom_filter const& rhs) noexcept { auto nrv = lhs; nrv |= rhs; return nrv; }
+        [[nodiscard]] friend constexpr blocked_bloom_filter operator&(blocked_bloom_filter const& lhs, blocked_bloom_filter const& rhs) noexcept { auto nrv = lhs; nrv &= rhs; return nrv; }
+};
+
+}       // namespace xstd
+
+#endif  // include guard
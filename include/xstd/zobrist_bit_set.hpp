@@ -0,0 +1,192 @@
+#ifndef XSTD_ZOBRIST_BIT_SET_HPP
+#define XSTD_ZOBRIST_BIT_SET_HPP
+
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit/hash.hpp>    // splitmix64
+#include <xstd/bit/intrin.hpp>  // countr_zero
+#include <xstd/bit_set.hpp>     // bit_set
+#include <array>                // array
+#include <cassert>              // assert
+#include <concepts>             // unsigned_integral
+#include <cstddef>              // size_t
+#include <cstdint>              // uint64_t
+#include <functional>           // hash
+#include <ranges>               // iota
+#include <utility>              // swap
+
+namespace xstd {
+namespace zobrist {
+
+// One random 64-bit key per element, from the splitmix64 sequence.
+template<std::size_t N>
+inline constexpr auto keys = []() {
+        auto nrv = std::array<std::uint64_t, N>();
+        auto state = std::uint64_t{0};
+        for (auto& k : nrv) {
+                k = bit::splitmix64(state);
+        }
+        return nrv;
+}();
+
+// The XOR of the keys of all N elements, the hash of the full set.
+template<std::size_t N>
+inline constexpr auto all_keys = []() {
+        auto nrv = std::uint64_t{0};
+        for (auto k : keys<N>) {
+                nrv ^= k;
+        }
+        return nrv;
+}();
+
+}       // namespace zobrist
+
+// A bit_set<N, Block> together with its Zobrist hash, the XOR of the keys of
+// its elements, as used for the transposition tables of game tree searches.
+// Every mutation keeps the hash up to date: one XOR for a single element,
+// a constant for clear, fill and complement, and one key lookup per changed
+// element for the bulk operations, which XOR the keys of the bits set in
+// the blockwise difference between the old and the new blocks. The set
+// itself is only readable, through set().
+template<std::size_t N, std::unsigned_integral Block = std::size_t>
+class zobrist_bit_set
+{
+public:
+        using set_type   = bit_set<N, Block>;
+        using value_type = std::size_t;
+        using size_type  = std::size_t;
+
+private:
+        static constexpr auto bits_per_block = set_type::bits_per_block;
+        static constexpr auto num_blocks     = set_type::num_blocks;
+        static constexpr auto const& keys    = zobrist::keys<N>;
+
+        std::uint64_t m_hash = 0;
+        set_type m_set{};
+
+        // Replaces every block b by f(b, mask block), and XORs the keys of
+        // the bits that changed into the hash.
+        template<class BinaryFunction>
+        constexpr zobrist_bit_set& transform(set_type const& mask, BinaryFunction f) noexcept
+        {
+                auto const dst = blocks(m_set);
+                auto const src = blocks(mask);
+                for (auto b : std::views::iota(0uz, num_blocks)) {
+                        auto const block = dst[b];
+                        set_block(m_set, b, static_cast<Block>(f(block, src[b])));
+                        for (auto delta = static_cast<Block>(block ^ dst[b]); delta != 0; delta &= static_cast<Block>(delta - 1)) {
+                                m_hash ^= keys[b * bits_per_block + bit::countr_zero(delta)];
+                        }
+                }
+                return *this;
+        }
+
+public:
+        constexpr zobrist_bit_set() = default;
+
+        // Hashes s from scratch, one key per element.
+        constexpr explicit zobrist_bit_set(set_type const& s) noexcept
+        :
+                m_set(s)
+        {
+                for (auto x : m_set) {
+                        m_hash ^= keys[x];
+                }
+        }
+
+        [[nodiscard]] constexpr set_type const& set() const noexcept { return m_set;  }
+        [[nodiscard]] constexpr std::uint64_t  hash() const noexcept { return m_hash; }
+
+        [[nodiscard]] constexpr bool contains(value_type x) const noexcept { return m_set.contains(x); }
+        [[nodiscard]] constexpr size_type size()            const noexcept { return m_set.size();      }
+        [[nodiscard]] constexpr bool empty()                const noexcept { return m_set.empty();     }
+
+        // Whether x was inserted.
+        constexpr bool insert(value_type x) noexcept
+        {
+                assert(x < N);
+                auto const inserted = m_set.insert(x).second;
+                if (inserted) {
+                        m_hash ^= keys[x];
+                }
+                return inserted;
+        }
+
+        // The number of erased elements.
+        constexpr size_type erase(value_type x) noexcept
+        {
+                assert(x < N);
+                auto const erased = m_set.erase(x);
+                if (erased != 0) {
+                        m_hash ^= keys[x];
+                }
+                return erased;
+        }
+
+        constexpr void complement(value_type x) noexcept
+        {
+                assert(x < N);
+                m_set.complement(x);
+                m_hash ^= keys[x];
+        }
+
+        constexpr void complement() noexcept
+        {
+                m_set.complement();
+                m_hash ^= zobrist::all_keys<N>;
+        }
+
+        constexpr void clear() noexcept
+        {
+                m_set.clear();
+                m_hash = 0;
+        }
+
+        constexpr void fill() noexcept
+        {
+                m_set.fill();
+                m_hash = zobrist::all_keys<N>;
+        }
+
+        constexpr void swap(zobrist_bit_set& other) noexcept
+        {
+                m_set.swap(other.m_set);
+                std::swap(m_hash, other.m_hash);
+        }
+
+        constexpr zobrist_bit_set& operator&=(set_type const& other) noexcept { return transform(other, [](Block x, Block y) { return x &  y; }); }
+        constexpr zobrist_bit_set& operator|=(set_type const& other) noexcept { return transform(other, [](Block x, Block y) { return x |  y; }); }
+        constexpr zobrist_bit_set& operator^=(set_type const& other) noexcept { return transform(other, [](Block x, Block y) { return x ^  y; }); }
+        constexpr zobrist_bit_set& operator-=(set_type const& other) noexcept { return transform(other, [](Block x, Block y) { return x & ~y; }); }
+
+        [[nodiscard]] friend constexpr bool operator==(zobrist_bit_set const& x, zobrist_bit_set const& y) noexcept
+        {
+                return x.m_set == y.m_set;
+        }
+};
+
+template<std::size_t N, std::unsigned_integral Block>
+constexpr void swap(zobrist_bit_set<N, Block>& x, zobrist_bit_set<N, Block>& y) noexcept
+{
+        x.swap(y);
+}
+
+}       // namespace xstd
+
+namespace std {
+
+template<size_t N, unsigned_integral Block>
+struct hash<xstd::zobrist_bit_set<N, Block>>
+{
+        [[nodiscard]] constexpr std::size_t operator()(xstd::zobrist_bit_set<N, Block> const& v) const noexcept
+        {
+                return static_cast<std::size_t>(v.hash());
+        }
+};
+
+}       // namespace std
+
+#endif  // include guard
@@ -0,0 +1,26 @@
+#pragma once
+
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>      // size_t
+#include <ranges>       // iota
+
+namespace xstd {
+
+// A random set with every element present with probability density / 16.
+template<class X>
+auto random_set(auto& urbg, std::size_t density)
+{
+        X x;
+        for (auto i : std::views::iota(0uz, X::max_size())) {
+                if (urbg() % 16 < density) {
+                        x.insert(i);
+                }
+        }
+        return x;
+}
+
+}       // namespace xstd
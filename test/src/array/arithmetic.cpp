@@ -0,0 +1,120 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit_array.hpp>           // add, bit_array, decrement, increment, negate, sub
+#include <boost/mp11/list.hpp>          // mp_list
+#include <boost/test/unit_test.hpp>     // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK
+#include <cstddef>                      // size_t
+#include <cstdint>                      // uint8_t, uint16_t, uint32_t, uint64_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+
+BOOST_AUTO_TEST_SUITE(Arithmetic)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       bit_array<  1, uint8_t>
+,       bit_array<  5, uint8_t>
+,       bit_array<  8, uint8_t>
+,       bit_array<  9, uint8_t>
+,       bit_array< 24, uint8_t>
+,       bit_array< 40, uint16_t>
+,       bit_array< 63, uint64_t>
+,       bit_array< 64, uint64_t>
+,       bit_array< 65, uint32_t>
+,       bit_array<128, uint32_t>
+,       bit_array<256, uint64_t>
+,       bit_array<300, uint64_t>
+#if defined(__GNUG__)
+,       bit_array<200, __uint128_t>
+#endif
+>;
+
+// One full adder per index: x + y + carry, returning the carry out.
+template<class X>
+auto ripple_add(X& x, X const& y, bool carry)
+{
+        X sum{};
+        for (auto i : std::views::iota(0uz, x.size())) {
+                auto const s = static_cast<int>(x[i]) + static_cast<int>(y[i]) + static_cast<int>(carry);
+                if (s & 1) {
+                        sum.m_bits.set(i);
+                }
+                carry = s > 1;
+        }
+        x = sum;
+        return carry;
+}
+
+template<class X>
+auto complement(X x)
+{
+        x.m_bits.flip();
+        return x;
+}
+
+// Random operands, mixed with the all-ones and the one operands that carry
+// (borrow) through every block.
+template<class X>
+auto random_operand(auto& urbg)
+{
+        X x{};
+        switch (urbg() % 4) {
+        case 0: x.fill(true); break;
+        case 1: x.m_bits.set(0); break;
+        default:
+                for (auto i : std::views::iota(0uz, x.size())) {
+                        if (urbg() % 2) {
+                                x.m_bits.set(i);
+                        }
+                }
+        }
+        return x;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Random, T, Types)
+{
+        auto urbg = std::mt19937_64(T().size());
+        T one{};
+        one.m_bits.set(0);
+        for ([[maybe_unused]] auto _ : std::views::iota(0, 500)) {
+                auto const x = random_operand<T>(urbg);
+                auto const y = random_operand<T>(urbg);
+
+                auto sum = x, expected_sum = x;
+                BOOST_CHECK(add(sum, y) == ripple_add(expected_sum, y, false));
+                BOOST_CHECK(sum == expected_sum);
+
+                // x - y == x + ~y + 1, borrowing if and only if that does not carry
+                auto difference = x, expected_difference = x;
+                BOOST_CHECK(sub(difference, y) != ripple_add(expected_difference, complement(y), true));
+                BOOST_CHECK(difference == expected_difference);
+
+                auto successor = x, expected_successor = x;
+                BOOST_CHECK(increment(successor) == ripple_add(expected_successor, one, false));
+                BOOST_CHECK(successor == expected_successor);
+
+                auto predecessor = x, expected_predecessor = x;
+                BOOST_CHECK(decrement(predecessor) != ripple_add(expected_predecessor, complement(T{}), false));
+                BOOST_CHECK(predecessor == expected_predecessor);
+
+                auto negative = x;
+                negate(negative);
+                add(negative, x);
+                BOOST_CHECK(negative == T{});
+        }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Constexpr, T, Types)
+{
+        constexpr auto ones = []() { T x{}; x.fill(true); return x; }();
+        static_assert([=]() { auto x = ones; return increment(x) and x == T{}; }());
+        static_assert([=]() { auto x = T{}; return decrement(x) and x == ones; }());
+        static_assert([=]() { auto x = T{}; negate(x); return x == T{}; }());
+        static_assert([=]() { auto x = ones; return add(x, ones) and sub(x, ones) and x == ones; }());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
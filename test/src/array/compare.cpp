@@ -0,0 +1,103 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <ext/boost/dynamic_bitset.hpp> // dynamic_bitset
+#include <ext/std/bitset.hpp>           // bitset
+#include <xstd/bit_array.hpp>           // bit_array
+#include <xstd/proxy/random_access.hpp> // view
+#include <boost/mp11/list.hpp>          // mp_list
+#include <boost/test/unit_test.hpp>     // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK
+#include <algorithm>                    // lexicographical_compare_three_way
+#include <bitset>                       // bitset
+#include <cstddef>                      // size_t
+#include <cstdint>                      // uint8_t, uint16_t, uint32_t, uint64_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+
+// The word-parallel <=> of bit_array, and of the random_access views of
+// std::bitset and boost::dynamic_bitset, against the lexicographic order of
+// their sequences of bools: exhaustively over all pairs for small sizes,
+// and over random pairs differing in one or more bits for larger sizes.
+
+BOOST_AUTO_TEST_SUITE(Compare)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       bit_array<  1, uint8_t>
+,       bit_array<  5, uint8_t>
+,       bit_array<  8, uint8_t>
+,       bit_array< 10, uint8_t>
+,       bit_array< 10, uint16_t>
+,       bit_array< 40, uint16_t>
+,       bit_array< 65, uint32_t>
+,       bit_array<128, uint64_t>
+,       bit_array<300, uint64_t>
+#if defined(__GNUG__)
+,       bit_array<200, __uint128_t>
+#endif
+>;
+
+template<class X>
+auto sequence_three_way(X const& x, X const& y)
+{
+        return std::lexicographical_compare_three_way(x.begin(), x.end(), y.begin(), y.end());
+}
+
+template<class X>
+auto from_bits(auto pred)
+{
+        auto nrv = X{};
+        for (auto i : std::views::iota(0uz, nrv.size())) {
+                if (pred(i)) {
+                        nrv.m_bits.set(i);
+                }
+        }
+        return nrv;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(BitArray, T, Types)
+{
+        constexpr auto N = T{}.size();
+        if constexpr (N <= 10) {
+                for (auto a : std::views::iota(0uz, 1uz << N)) {
+                        auto const x = from_bits<T>([&](auto i) { return (a >> i) & 1; });
+                        for (auto b : std::views::iota(0uz, 1uz << N)) {
+                                auto const y = from_bits<T>([&](auto i) { return (b >> i) & 1; });
+                                BOOST_CHECK((x <=> y) == sequence_three_way(x, y));
+                        }
+                }
+        } else {
+                auto urbg = std::mt19937_64(N);
+                for ([[maybe_unused]] auto _ : std::views::iota(0, 10000)) {
+                        auto const x = from_bits<T>([&](auto) { return urbg() % 2; });
+                        auto y = x;
+                        y.m_bits.flip(urbg() % N);
+                        if (urbg() % 2) {
+                                y.m_bits.flip(urbg() % N);
+                        }
+                        BOOST_CHECK((x <=> y) == sequence_three_way(x, y));
+                        BOOST_CHECK((y <=> x) == sequence_three_way(y, x));
+                        BOOST_CHECK((x <=> x) == std::strong_ordering::equal);
+                }
+        }
+}
+
+BOOST_AUTO_TEST_CASE(RandomAccessViews)
+{
+        constexpr auto N = 17uz;
+        for (auto a : std::views::iota(0uz, 1uz << 9)) {
+                for (auto b : std::views::iota(0uz, 1uz << 9)) {
+                        auto sx = std::bitset<N>(a << 4), sy = std::bitset<N>(b << 4);
+                        auto dx = boost::dynamic_bitset<>(N, a << 4), dy = boost::dynamic_bitset<>(N, b << 4);
+                        auto const sv = proxy::random_access::view(sx), tv = proxy::random_access::view(sy);
+                        auto const dv = proxy::random_access::view(dx), ev = proxy::random_access::view(dy);
+                        BOOST_CHECK((sv <=> tv) == sequence_three_way(sv, tv));
+                        BOOST_CHECK((dv <=> ev) == sequence_three_way(dv, ev));
+                }
+        }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
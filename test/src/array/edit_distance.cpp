@@ -0,0 +1,116 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <opt/array/edit_distance.hpp>  // edit_distance_pattern
+#include <boost/mp11/list.hpp>          // mp_list
+#include <boost/test/unit_test.hpp>     // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK, BOOST_CHECK_EQUAL
+#include <algorithm>                    // min
+#include <cstddef>                      // size_t
+#include <cstdint>                      // uint8_t, uint32_t, uint64_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+#include <string>                       // string
+#include <string_view>                  // string_view
+#include <vector>                       // vector
+
+BOOST_AUTO_TEST_SUITE(EditDistance)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       edit_distance_pattern<  1, uint8_t>
+,       edit_distance_pattern<  8, uint8_t>
+,       edit_distance_pattern< 40, uint8_t>
+,       edit_distance_pattern< 64, uint64_t>
+,       edit_distance_pattern<100, uint32_t>
+,       edit_distance_pattern<300, uint64_t>
+>;
+
+// The dynamic programming matrix, one column at a time, for a top row that is
+// either D[0][j] = j (distance) or D[0][j] = 0 (search). Returns the bottom
+// row D[m][j] for every j.
+auto reference_bottom_row(std::string_view pattern, std::string_view text, bool search)
+{
+        auto const m = pattern.size();
+        auto column = std::vector<std::size_t>(m + 1);
+        for (auto i : std::views::iota(0uz, m + 1)) {
+                column[i] = i;
+        }
+        auto bottom = std::vector<std::size_t>{ column[m] };
+        for (auto j : std::views::iota(0uz, text.size())) {
+                auto diagonal = column[0];
+                column[0] = search ? 0 : j + 1;
+                for (auto i : std::views::iota(1uz, m + 1)) {
+                        auto const up = column[i];
+                        column[i] = std::min({ up + 1, column[i - 1] + 1, diagonal + (pattern[i - 1] != text[j]) });
+                        diagonal = up;
+                }
+                bottom.push_back(column[m]);
+        }
+        return bottom;
+}
+
+// Small alphabets give long runs of matches that exercise the carry between blocks.
+auto random_string(auto& urbg, std::size_t size, std::size_t alphabet)
+{
+        auto s = std::string(size, 'a');
+        for (auto& c : s) {
+                c = static_cast<char>('a' + urbg() % alphabet);
+        }
+        return s;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Distance, T, Types)
+{
+        constexpr auto N = T::capacity();
+        auto urbg = std::mt19937_64(N);
+        for ([[maybe_unused]] auto _ : std::views::iota(0, 200)) {
+                auto const alphabet = 1 + urbg() % 4;
+                auto const p = random_string(urbg, urbg() % (N + 1), alphabet);
+                auto const t = random_string(urbg, urbg() % (2 * N + 1), alphabet);
+                auto const expected = reference_bottom_row(p, t, false).back();
+                auto const x = T(p);
+                BOOST_CHECK_EQUAL(x.distance(t), expected);
+                for (auto k : { 0uz, 1uz, 5uz, N / 4, N }) {
+                        BOOST_CHECK_EQUAL(x.distance(t, k), std::min(expected, k + 1));
+                }
+        }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Search, T, Types)
+{
+        constexpr auto N = T::capacity();
+        auto urbg = std::mt19937_64(N);
+        for ([[maybe_unused]] auto _ : std::views::iota(0, 200)) {
+                auto const alphabet = 1 + urbg() % 4;
+                auto const p = random_string(urbg, urbg() % (N + 1), alphabet);
+                auto const t = random_string(urbg, urbg() % (4 * N + 1), alphabet);
+                auto const bottom = reference_bottom_row(p, t, true);
+                auto const x = T(p);
+                for (auto k : { 0uz, 1uz, 5uz, N / 4, N }) {
+                        auto expected = std::vector<std::size_t>();
+                        for (auto j : std::views::iota(0uz, bottom.size())) {
+                                if (bottom[j] <= k) {
+                                        expected.push_back(j);
+                                }
+                        }
+                        auto const matches = x.search(t, k);
+                        BOOST_CHECK(matches == expected);
+                }
+        }
+}
+
+BOOST_AUTO_TEST_CASE(Examples)
+{
+        auto const kitten = edit_distance_pattern<8>("kitten");
+        BOOST_CHECK_EQUAL(kitten.distance("sitting"), 3uz);
+        BOOST_CHECK_EQUAL(kitten.distance("sitting", 2), 3uz);
+        BOOST_CHECK_EQUAL(kitten.distance(""), 6uz);
+        BOOST_CHECK(kitten.search("the mitten and the kitchen", 1) == (std::vector{ 10uz }));
+        BOOST_CHECK(kitten.search("the mitten and the kitchen", 2) == (std::vector{ 9uz, 10uz, 11uz, 26uz }));
+        static_assert(edit_distance_pattern<8>("flaw").distance("lawn") == 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,73 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit/transpose.hpp>       // square_matrix, transpose
+#include <boost/mp11/list.hpp>          // mp_list
+#include <boost/test/unit_test.hpp>     // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK
+#include <cstddef>                      // size_t
+#include <cstdint>                      // uint8_t, uint16_t, uint32_t, uint64_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+
+BOOST_AUTO_TEST_SUITE(Transpose)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       uint8_t
+,       uint16_t
+,       uint32_t
+,       uint64_t
+#if defined(__GNUG__)
+,       __uint128_t
+#endif
+>;
+
+template<class T>
+constexpr auto bit(T x, std::size_t c)
+{
+        return static_cast<bool>((x >> c) & 1);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Random, T, Types)
+{
+        auto urbg = std::mt19937_64(sizeof(T));
+        for ([[maybe_unused]] auto _ : std::views::iota(0, 100)) {
+                auto m = bit::square_matrix<T>();
+                for (auto& row : m) {
+                        row = static_cast<T>(urbg());
+                        if constexpr (sizeof(T) > sizeof(std::uint64_t)) {
+                                row = static_cast<T>(row << 64 | urbg());
+                        }
+                }
+                auto t = m;
+                bit::transpose(t);
+                for (auto r : std::views::iota(0uz, m.size())) {
+                        for (auto c : std::views::iota(0uz, m.size())) {
+                                BOOST_CHECK(bit(t[c], r) == bit(m[r], c));
+                        }
+                }
+                bit::transpose(t);
+                BOOST_CHECK(t == m);
+        }
+}
+
+// A single row transposes to a single column.
+BOOST_AUTO_TEST_CASE_TEMPLATE(Constexpr, T, Types)
+{
+        static_assert([]() {
+                auto m = bit::square_matrix<T>();
+                m[1] = static_cast<T>(~static_cast<T>(0));
+                bit::transpose(m);
+                for (auto row : m) {
+                        if (row != 2) {
+                                return false;
+                        }
+                }
+                return true;
+        }());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,125 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bloom_filter.hpp>        // blocked_bloom_filter, bloom_filter
+#include <boost/mp11/list.hpp>          // mp_list
+#include <boost/test/unit_test.hpp>     // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK, BOOST_CHECK_EQUAL, BOOST_CHECK_LT
+#include <cmath>                        // exp, pow
+#include <cstddef>                      // size_t
+#include <cstdint>                      // uint8_t, uint32_t, uint64_t
+#include <iterator>                     // back_inserter
+#include <memory>                       // make_unique
+#include <random>                       // mt19937_64
+#include <ranges>                       // all_of, iota
+#include <vector>                       // vector
+
+BOOST_AUTO_TEST_SUITE(BloomFilter)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       bloom_filter<         1000, 7, uint8_t>
+,       bloom_filter<(1uz << 16), 7, uint64_t>
+,       bloom_filter<       100000, 3, uint32_t>
+,       blocked_bloom_filter< 1000, 7>
+,       blocked_bloom_filter<(1uz << 16), 7>
+,       blocked_bloom_filter<100000, 3, uint32_t>
+>;
+
+auto random_hashes(std::size_t n, std::uint64_t seed)
+{
+        auto urbg = std::mt19937_64(seed);
+        auto hashes = std::vector<std::uint64_t>(n);
+        for (auto& h : hashes) {
+                h = urbg();
+        }
+        return hashes;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(NoFalseNegatives, T, Types)
+{
+        auto const n = T::num_bits / 10;
+        auto const hashes = random_hashes(n, 1);
+        auto filter = std::make_unique<T>();
+        BOOST_CHECK(filter->empty());
+        for (auto h : hashes) {
+                filter->insert(h);
+        }
+        BOOST_CHECK(std::ranges::all_of(hashes, [&](auto h) { return filter->contains(h); }));
+        BOOST_CHECK(not filter->empty());
+        BOOST_CHECK(filter->count() <= n * T::num_probes);
+
+        filter->clear();
+        BOOST_CHECK(filter->empty());
+        BOOST_CHECK_EQUAL(filter->count(), 0uz);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(FalsePositiveRate, T, Types)
+{
+        // 10 bits per key: the classic rate (1 - e^(-K n / m))^K, with some
+        // slack for the blocked variant and for sampling noise.
+        auto const n = T::num_bits / 10;
+        auto filter = std::make_unique<T>();
+        for (auto h : random_hashes(n, 1)) {
+                filter->insert(h);
+        }
+        auto const k = static_cast<double>(T::num_probes);
+        auto const expected = std::pow(1.0 - std::exp(-k * static_cast<double>(n) / static_cast<double>(T::num_bits)), k);
+        auto false_positives = 0uz;
+        auto const queries = random_hashes(100000, 2);
+        for (auto h : queries) {
+                false_positives += filter->contains(h);
+        }
+        BOOST_CHECK_LT(static_cast<double>(false_positives) / static_cast<double>(queries.size()), 2.0 * expected + 0.005);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Batched, T, Types)
+{
+        auto const hashes = random_hashes(T::num_bits / 10 + 5, 3);
+        auto one = std::make_unique<T>();
+        for (auto h : hashes) {
+                one->insert(h);
+        }
+        auto many = std::make_unique<T>();
+        many->insert_many(hashes);
+        BOOST_CHECK(*one == *many);
+
+        auto const queries = random_hashes(1000, 4);
+        auto results = std::vector<bool>();
+        many->contains_many(queries, std::back_inserter(results));
+        BOOST_CHECK_EQUAL(results.size(), queries.size());
+        for (auto i : std::views::iota(0uz, queries.size())) {
+                BOOST_CHECK_EQUAL(results[i], one->contains(queries[i]));
+        }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Merge, T, Types)
+{
+        auto const lhs_hashes = random_hashes(100, 5);
+        auto const rhs_hashes = random_hashes(100, 6);
+        auto lhs = std::make_unique<T>();
+        auto rhs = std::make_unique<T>();
+        lhs->insert_many(lhs_hashes);
+        rhs->insert_many(rhs_hashes);
+
+        auto both = std::make_unique<T>(*lhs | *rhs);
+        BOOST_CHECK(std::ranges::all_of(lhs_hashes, [&](auto h) { return both->contains(h); }));
+        BOOST_CHECK(std::ranges::all_of(rhs_hashes, [&](auto h) { return both->contains(h); }));
+
+        *both &= *lhs;
+        BOOST_CHECK(*both == *lhs);
+        BOOST_CHECK((*lhs & *lhs) == *lhs);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Constexpr, T, Types)
+{
+        static_assert([]() {
+                auto filter = T();
+                filter.insert(42);
+                return filter.contains(42) and not filter.empty();
+        }());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,130 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit_grid.hpp>            // bit_grid, direction, fill, flood_fill
+#include <boost/mp11/algorithm.hpp>     // mp_for_each
+#include <boost/mp11/list.hpp>          // mp_list
+#include <boost/test/unit_test.hpp>     // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK
+#include <cstddef>                      // size_t
+#include <cstdint>                      // uint8_t, uint16_t, uint32_t, uint64_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+#include <type_traits>                  // integral_constant
+
+BOOST_AUTO_TEST_SUITE(Fill)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       bit_grid< 1,  1, uint8_t>
+,       bit_grid< 8,  8, uint8_t>
+,       bit_grid< 8,  8, uint64_t>
+,       bit_grid< 1, 70, uint8_t>
+,       bit_grid<70,  1, uint32_t>
+,       bit_grid<10, 10, uint64_t>
+,       bit_grid<10, 10, uint64_t, 1>
+,       bit_grid<13,  7, uint16_t, 3>
+,       bit_grid<19, 19, uint64_t, 2>
+,       bit_grid<64, 64, uint64_t>
+>;
+
+using Directions = boost::mp11::mp_list
+<       std::integral_constant<direction, direction::north     >
+,       std::integral_constant<direction, direction::north_east>
+,       std::integral_constant<direction, direction::east      >
+,       std::integral_constant<direction, direction::south_east>
+,       std::integral_constant<direction, direction::south     >
+,       std::integral_constant<direction, direction::south_west>
+,       std::integral_constant<direction, direction::west      >
+,       std::integral_constant<direction, direction::north_west>
+>;
+
+template<class G>
+auto random_grid(auto& urbg, unsigned density)
+{
+        G g;
+        for (auto y : std::views::iota(0uz, G::height)) {
+                for (auto x : std::views::iota(0uz, G::width)) {
+                        if (urbg() % 8 < density) {
+                                g.insert(x, y);
+                        }
+                }
+        }
+        return g;
+}
+
+// One single step at a time, until the slides are blocked everywhere.
+template<direction D, class G>
+auto iterative_fill(G generators, G const& empty)
+{
+        for (auto step = generators; not step.empty();) {
+                step = step.template shift<D>(empty) - generators;
+                generators |= step;
+        }
+        return generators;
+}
+
+// One orthogonal (or diagonal) single step at a time.
+template<std::size_t Neighbors, class G>
+auto iterative_flood_fill(G const& seed, G const& passable)
+{
+        auto filled = seed & passable;
+        for (auto frontier = filled; not frontier.empty();) {
+                auto next =
+                        frontier.template shift<direction::north>(passable) |
+                        frontier.template shift<direction::east >(passable) |
+                        frontier.template shift<direction::south>(passable) |
+                        frontier.template shift<direction::west >(passable)
+                ;
+                if constexpr (Neighbors == 8) {
+                        next |=
+                                frontier.template shift<direction::north_east>(passable) |
+                                frontier.template shift<direction::south_east>(passable) |
+                                frontier.template shift<direction::south_west>(passable) |
+                                frontier.template shift<direction::north_west>(passable)
+                        ;
+                }
+                frontier = next - filled;
+                filled |= frontier;
+        }
+        return filled;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Occluded, T, Types)
+{
+        auto urbg = std::mt19937_64(T::width * T::height);
+        for (auto density : { 0u, 2u, 4u, 6u, 8u }) {
+                for ([[maybe_unused]] auto _ : std::views::iota(0, 10)) {
+                        auto const empty = random_grid<T>(urbg, density);
+                        auto const generators = random_grid<T>(urbg, 1) - empty;
+                        boost::mp11::mp_for_each<Directions>([&](auto D) {
+                                BOOST_CHECK(fill<D()>(generators, empty) == iterative_fill<D()>(generators, empty));
+                        });
+                }
+        }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Flood, T, Types)
+{
+        auto urbg = std::mt19937_64(T::width * T::height);
+        for (auto density : { 0u, 3u, 4u, 5u, 8u }) {
+                for ([[maybe_unused]] auto _ : std::views::iota(0, 10)) {
+                        auto const passable = random_grid<T>(urbg, density);
+                        auto const seed = random_grid<T>(urbg, 1);
+                        BOOST_CHECK(flood_fill   (seed, passable) == iterative_flood_fill<4>(seed, passable));
+                        BOOST_CHECK(flood_fill<8>(seed, passable) == iterative_flood_fill<8>(seed, passable));
+                }
+        }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Constexpr, T, Types)
+{
+        constexpr auto corner = []() { T g; g.insert(0, 0); return g; }();
+        static_assert(fill<direction::east >(corner, T::squares()) == T::row(0));
+        static_assert(fill<direction::north>(corner, T::squares()) == T::column(0));
+        static_assert(flood_fill(corner, T::squares()) == T::squares());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
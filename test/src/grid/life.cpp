@@ -0,0 +1,163 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <opt/grid/life.hpp>            // conway, highlife, life_rule, life_step, life_world, parse_life_rule, seeds
+#include <xstd/bit_grid.hpp>            // bit_grid
+#include <boost/mp11/list.hpp>          // mp_list
+#include <boost/test/unit_test.hpp>     // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK, BOOST_CHECK_THROW
+#include <cstddef>                      // ptrdiff_t, size_t
+#include <cstdint>                      // uint8_t, uint16_t, uint64_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+#include <stdexcept>                    // invalid_argument
+#include <utility>                      // pair
+#include <vector>                       // vector
+
+BOOST_AUTO_TEST_SUITE(Life)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       bit_grid< 1,  1, uint8_t>
+,       bit_grid< 8,  8, uint64_t>
+,       bit_grid<10, 10, uint64_t, 1>
+,       bit_grid<13,  7, uint16_t, 3>
+,       bit_grid<64, 64, uint64_t>
+>;
+
+// One cell at a time, on a width x height board that is either bounded by
+// dead cells or toroidal.
+template<life_rule Rule>
+auto reference_step(std::vector<std::vector<bool>> const& alive, bool torus)
+{
+        auto const h = static_cast<std::ptrdiff_t>(alive.size());
+        auto const w = static_cast<std::ptrdiff_t>(alive[0].size());
+        auto next = alive;
+        for (auto y : std::views::iota(0z, h)) {
+                for (auto x : std::views::iota(0z, w)) {
+                        auto n = 0;
+                        for (auto dy : { -1z, 0z, 1z }) {
+                                for (auto dx : { -1z, 0z, 1z }) {
+                                        auto i = x + dx, j = y + dy;
+                                        if (torus) {
+                                                i = (i + w) % w;
+                                                j = (j + h) % h;
+                                        }
+                                        if ((dx != 0 or dy != 0) and 0 <= i and i < w and 0 <= j and j < h and alive[static_cast<std::size_t>(j)][static_cast<std::size_t>(i)]) {
+                                                ++n;
+                                        }
+                                }
+                        }
+                        auto const& cell = alive[static_cast<std::size_t>(y)][static_cast<std::size_t>(x)];
+                        next[static_cast<std::size_t>(y)][static_cast<std::size_t>(x)] = ((cell ? Rule.survival : Rule.birth) >> n) & 1;
+                }
+        }
+        return next;
+}
+
+auto random_cells(auto& urbg, std::size_t w, std::size_t h)
+{
+        auto cells = std::vector<std::vector<bool>>(h, std::vector<bool>(w));
+        for (auto& row : cells) {
+                for (auto&& cell : row) {
+                        cell = urbg() % 3 == 0;
+                }
+        }
+        return cells;
+}
+
+template<class G>
+auto to_grid(std::vector<std::vector<bool>> const& cells)
+{
+        G g;
+        for (auto y : std::views::iota(0uz, G::height)) {
+                for (auto x : std::views::iota(0uz, G::width)) {
+                        if (cells[y][x]) {
+                                g.insert(x, y);
+                        }
+                }
+        }
+        return g;
+}
+
+template<life_rule Rule, class G>
+void check_bounded(auto& urbg)
+{
+        auto cells = random_cells(urbg, G::width, G::height);
+        auto g = to_grid<G>(cells);
+        for ([[maybe_unused]] auto _ : std::views::iota(0, 10)) {
+                cells = reference_step<Rule>(cells, false);
+                g = life_step<Rule>(g);
+                BOOST_CHECK(g == to_grid<G>(cells));
+        }
+}
+
+template<life_rule Rule, class G>
+void check_torus(auto& urbg, std::size_t tiles_x, std::size_t tiles_y)
+{
+        auto world = life_world<G>(tiles_x, tiles_y);
+        auto cells = random_cells(urbg, world.width(), world.height());
+        for (auto y : std::views::iota(0uz, world.height())) {
+                for (auto x : std::views::iota(0uz, world.width())) {
+                        if (cells[y][x]) {
+                                world.insert(x, y);
+                        }
+                }
+        }
+        for ([[maybe_unused]] auto _ : std::views::iota(0, 10)) {
+                cells = reference_step<Rule>(cells, true);
+                world.template step<Rule>();
+                for (auto y : std::views::iota(0uz, world.height())) {
+                        for (auto x : std::views::iota(0uz, world.width())) {
+                                BOOST_CHECK(world.contains(x, y) == cells[y][x]);
+                        }
+                }
+        }
+}
+
+BOOST_AUTO_TEST_CASE(Rules)
+{
+        static_assert(conway.birth == 0b1000 and conway.survival == 0b1100);
+        static_assert(highlife.birth == 0b1001000);
+        static_assert(seeds.survival == 0);
+        BOOST_CHECK_THROW(parse_life_rule("B3/S2x"), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Bounded, T, Types)
+{
+        auto urbg = std::mt19937_64(T::width * T::height);
+        check_bounded<conway,   T>(urbg);
+        check_bounded<highlife, T>(urbg);
+        check_bounded<seeds,    T>(urbg);
+        check_bounded<parse_life_rule("B0/S8"), T>(urbg);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Torus, T, Types)
+{
+        auto urbg = std::mt19937_64(T::width * T::height);
+        check_torus<conway,   T>(urbg, 1, 1);
+        check_torus<conway,   T>(urbg, 3, 2);
+        check_torus<highlife, T>(urbg, 2, 3);
+}
+
+BOOST_AUTO_TEST_CASE(Glider)
+{
+        using G = bit_grid<16, 16, uint64_t>;
+        auto world = life_world<G>(2, 2);
+        for (auto [ x, y ] : { std::pair(1uz, 2uz), std::pair(2uz, 0uz), std::pair(2uz, 2uz), std::pair(3uz, 1uz), std::pair(3uz, 2uz) }) {
+                world.insert(x, y);
+        }
+        // A glider moves one cell diagonally every 4 generations,
+        // and all the way around the 32 x 32 torus in 128.
+        for ([[maybe_unused]] auto _ : std::views::iota(0, 128)) {
+                world.step();
+                BOOST_CHECK(world.size() == 5uz);
+        }
+        for (auto [ x, y ] : { std::pair(1uz, 2uz), std::pair(2uz, 0uz), std::pair(2uz, 2uz), std::pair(3uz, 1uz), std::pair(3uz, 2uz) }) {
+                BOOST_CHECK(world.contains(x, y));
+        }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,104 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit_grid.hpp>            // bit_grid, direction
+#include <boost/mp11/algorithm.hpp>     // mp_for_each
+#include <boost/mp11/list.hpp>          // mp_list
+#include <boost/test/unit_test.hpp>     // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK
+#include <cstddef>                      // ptrdiff_t, size_t
+#include <cstdint>                      // uint8_t, uint16_t, uint32_t, uint64_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+#include <type_traits>                  // integral_constant
+
+BOOST_AUTO_TEST_SUITE(Shift)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       bit_grid< 1,  1, uint8_t>
+,       bit_grid< 8,  8, uint8_t>
+,       bit_grid< 8,  8, uint64_t>
+,       bit_grid< 1, 70, uint8_t>
+,       bit_grid<70,  1, uint32_t>
+,       bit_grid<10, 10, uint64_t>
+,       bit_grid<10, 10, uint64_t, 1>
+,       bit_grid< 5,  9, uint8_t,  1>
+,       bit_grid<13,  7, uint16_t, 3>
+,       bit_grid<19, 19, uint64_t, 2>
+,       bit_grid<64, 64, uint64_t>
+>;
+
+using Directions = boost::mp11::mp_list
+<       std::integral_constant<direction, direction::north     >
+,       std::integral_constant<direction, direction::north_east>
+,       std::integral_constant<direction, direction::east      >
+,       std::integral_constant<direction, direction::south_east>
+,       std::integral_constant<direction, direction::south     >
+,       std::integral_constant<direction, direction::south_west>
+,       std::integral_constant<direction, direction::west      >
+,       std::integral_constant<direction, direction::north_west>
+>;
+
+template<class G>
+auto random_grid(auto& urbg)
+{
+        G g;
+        for (auto y : std::views::iota(0uz, G::height)) {
+                for (auto x : std::views::iota(0uz, G::width)) {
+                        if (urbg() % 2) {
+                                g.insert(x, y);
+                        }
+                }
+        }
+        return g;
+}
+
+// The square that a step in direction d reaches from (x, y), if on the board.
+template<class G>
+bool reaches(G const& g, direction d, std::size_t x, std::size_t y)
+{
+        auto const from_x = static_cast<std::ptrdiff_t>(x) - G::dx(d);
+        auto const from_y = static_cast<std::ptrdiff_t>(y) - G::dy(d);
+        return
+                0 <= from_x and from_x < static_cast<std::ptrdiff_t>(G::width) and
+                0 <= from_y and from_y < static_cast<std::ptrdiff_t>(G::height) and
+                g.contains(static_cast<std::size_t>(from_x), static_cast<std::size_t>(from_y))
+        ;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Random, T, Types)
+{
+        auto urbg = std::mt19937_64(T::width * T::height);
+        for ([[maybe_unused]] auto _ : std::views::iota(0, 25)) {
+                auto const g = random_grid<T>(urbg);
+                auto const target = random_grid<T>(urbg);
+                BOOST_CHECK((g | ~g) == T::squares());
+                BOOST_CHECK((g & ~g).empty());
+                boost::mp11::mp_for_each<Directions>([&](auto D) {
+                        auto const s  = g.template shift<D()>();
+                        auto const st = g.template shift<D()>(target);
+                        BOOST_CHECK(s.size() <= g.size());
+                        BOOST_CHECK(st == (s & target));
+                        for (auto y : std::views::iota(0uz, T::height)) {
+                                for (auto x : std::views::iota(0uz, T::width)) {
+                                        BOOST_CHECK(s.contains(x, y) == reaches(g, D(), x, y));
+                                }
+                        }
+                });
+        }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Constexpr, T, Types)
+{
+        constexpr auto corner = []() { T g; g.insert(0, 0); return g; }();
+        static_assert(corner.template shift<direction::west>().empty());
+        static_assert(corner.template shift<direction::south>().empty());
+        static_assert(corner.template shift<direction::south_east>().empty());
+        static_assert(T::squares().template shift<direction::east>() == T::squares() - T::column(0));
+        static_assert(T::squares().template shift<direction::north>() == T::squares() - T::row(0));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,101 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/atomic_bit_set.hpp>      // atomic_bit_set
+#include <xstd/bit_set.hpp>             // bit_set
+#include <boost/mp11/list.hpp>          // mp_list
+#include <boost/test/unit_test.hpp>     // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK, BOOST_CHECK_EQUAL
+#include <algorithm>                    // shuffle
+#include <atomic>                       // memory_order_relaxed
+#include <cstddef>                      // size_t
+#include <cstdint>                      // uint8_t, uint16_t, uint32_t, uint64_t
+#include <numeric>                      // iota
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+#include <thread>                       // jthread
+#include <vector>                       // vector
+
+BOOST_AUTO_TEST_SUITE(AtomicBitSet)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       atomic_bit_set<  1, uint8_t>
+,       atomic_bit_set< 20, uint8_t>
+,       atomic_bit_set< 64, uint16_t>
+,       atomic_bit_set<100, uint32_t>
+,       atomic_bit_set<300, uint64_t>
+>;
+
+constexpr auto num_threads = 4uz;
+
+// Random sequences of all operations from a single thread, each checked
+// against the same operation on a plain bit_set.
+BOOST_AUTO_TEST_CASE_TEMPLATE(Sequential, T, Types)
+{
+        using S = typename T::set_type;
+        constexpr auto N = S::max_size();
+        auto urbg = std::mt19937_64(N);
+        auto a = T();
+        auto s = S();
+        BOOST_CHECK(a.snapshot() == s);
+        BOOST_CHECK_EQUAL(find_first(a), N);
+        for ([[maybe_unused]] auto _ : std::views::iota(0, 2000)) {
+                auto const x = urbg() % N;
+                switch (urbg() % 7) {
+                case 0: BOOST_CHECK_EQUAL(a.insert(x),                                s.insert(x).second); break;
+                case 1: BOOST_CHECK_EQUAL(a.erase(x),                                 s.erase(x));         break;
+                case 2: BOOST_CHECK_EQUAL(a.test_and_set(x, std::memory_order_relaxed), not s.insert(x).second); break;
+                case 3: BOOST_CHECK_EQUAL(a.test_and_reset(x),                        s.erase(x) == 1);    break;
+                case 4: if (urbg() % 32 == 0) { a.clear(); s.clear(); } break;
+                default: BOOST_CHECK_EQUAL(a.contains(x), s.contains(x)); break;
+                }
+                BOOST_CHECK(a.snapshot() == s);
+                BOOST_CHECK_EQUAL(find_first(a), s.empty() ? N : *s.begin());
+        }
+        BOOST_CHECK(T(s).snapshot() == s);
+}
+
+// Several threads inserting all elements in different orders: every element
+// is inserted by exactly one thread. Then several threads repeatedly
+// claiming the first element: every element is erased by exactly one thread.
+BOOST_AUTO_TEST_CASE_TEMPLATE(Concurrent, T, Types)
+{
+        using S = typename T::set_type;
+        constexpr auto N = S::max_size();
+        auto a = T();
+        auto inserted = std::vector<std::size_t>(num_threads);
+        {
+                auto threads = std::vector<std::jthread>();
+                for (auto t : std::views::iota(0uz, num_threads)) {
+                        threads.emplace_back([&, t]() {
+                                auto order = std::vector<std::size_t>(N);
+                                std::iota(order.begin(), order.end(), 0uz);
+                                std::ranges::shuffle(order, std::mt19937_64(t));
+                                for (auto x : order) {
+                                        inserted[t] += a.insert(x);
+                                }
+                        });
+                }
+        }
+        BOOST_CHECK_EQUAL(std::reduce(inserted.begin(), inserted.end()), N);
+        BOOST_CHECK(a.snapshot() == ~S());
+
+        auto erased = std::vector<std::size_t>(num_threads);
+        {
+                auto threads = std::vector<std::jthread>();
+                for (auto t : std::views::iota(0uz, num_threads)) {
+                        threads.emplace_back([&, t]() {
+                                for (auto x = find_first(a); x != N; x = find_first(a)) {
+                                        erased[t] += a.erase(x);
+                                }
+                        });
+                }
+        }
+        BOOST_CHECK_EQUAL(std::reduce(erased.begin(), erased.end()), N);
+        BOOST_CHECK(a.snapshot() == S());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
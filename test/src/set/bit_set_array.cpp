@@ -0,0 +1,119 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <set/random.hpp>               // random_set
+#include <xstd/bit_set_array.hpp>       // bit_set_array
+#include <xstd/bit_set.hpp>             // bit_set
+#include <boost/mp11/list.hpp>          // mp_list
+#include <boost/test/unit_test.hpp>     // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK, BOOST_CHECK_EQUAL
+#include <cstddef>                      // size_t
+#include <cstdint>                      // uint8_t, uint16_t, uint32_t, uint64_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+#include <vector>                       // vector
+
+BOOST_AUTO_TEST_SUITE(BitSetArray)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       bit_set_array<  1, uint8_t>
+,       bit_set_array< 20, uint8_t>
+,       bit_set_array< 64, uint16_t>
+,       bit_set_array<100, uint32_t>
+,       bit_set_array<256, uint64_t>
+,       bit_set_array<300, uint64_t>
+>;
+
+// Checks every set and every bulk query against the same operations on a
+// vector of bit_sets.
+template<class T>
+void check(T const& a, std::vector<typename T::value_type> const& v, auto& urbg)
+{
+        using S = typename T::value_type;
+        BOOST_CHECK_EQUAL(a.size(), v.size());
+        BOOST_CHECK_EQUAL(a.empty(), v.empty());
+        auto const counts = a.counts();
+        BOOST_CHECK_EQUAL(counts.size(), v.size());
+        for (auto i : std::views::iota(0uz, v.size())) {
+                BOOST_CHECK(a[i] == v[i]);
+                BOOST_CHECK(static_cast<S>(a[i]) == v[i]);
+                BOOST_CHECK_EQUAL(a[i].size(), v[i].size());
+                BOOST_CHECK_EQUAL(a[i].empty(), v[i].empty());
+                BOOST_CHECK_EQUAL(counts[i], v[i].size());
+                for (auto x : std::views::iota(0uz, S::max_size())) {
+                        BOOST_CHECK_EQUAL(a[i].contains(x), v[i].contains(x));
+                }
+        }
+        auto const mask = random_set<S>(urbg, urbg() % 17);
+        auto subsets = std::vector<std::size_t>();
+        auto supersets = std::vector<std::size_t>();
+        auto intersecting = std::vector<std::size_t>();
+        for (auto i : std::views::iota(0uz, v.size())) {
+                if (v[i].is_subset_of(mask)) { subsets.push_back(i); }
+                if (mask.is_subset_of(v[i])) { supersets.push_back(i); }
+                if (v[i].intersects(mask))   { intersecting.push_back(i); }
+        }
+        BOOST_CHECK(a.subsets_of(mask) == subsets);
+        BOOST_CHECK(a.supersets_of(mask) == supersets);
+        BOOST_CHECK(a.intersecting(mask) == intersecting);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Random, T, Types)
+{
+        using S = typename T::value_type;
+        auto urbg = std::mt19937_64(S::max_size());
+        auto a = T();
+        auto v = std::vector<S>();
+        check(a, v, urbg);
+        for (auto n : { 1uz, 63uz, 64uz, 65uz, 200uz }) {
+                while (v.size() < n) {
+                        v.push_back(random_set<S>(urbg, urbg() % 17));
+                        a.push_back(v.back());
+                }
+                check(a, v, urbg);
+
+                auto const mask = random_set<S>(urbg, urbg() % 17);
+                switch (urbg() % 4) {
+                case 0: a &= mask; for (auto& s : v) { s &= mask; } break;
+                case 1: a |= mask; for (auto& s : v) { s |= mask; } break;
+                case 2: a ^= mask; for (auto& s : v) { s ^= mask; } break;
+                case 3: a -= mask; for (auto& s : v) { s -= mask; } break;
+                }
+                check(a, v, urbg);
+
+                for ([[maybe_unused]] auto _ : std::views::iota(0, 20)) {
+                        auto const i = urbg() % v.size();
+                        auto const x = urbg() % S::max_size();
+                        switch (urbg() % 4) {
+                        case 0: a[i].insert(x);     v[i].insert(x);     break;
+                        case 1: a[i].erase(x);      v[i].erase(x);      break;
+                        case 2: a[i].complement(x); v[i].complement(x); break;
+                        case 3: {
+                                auto const j = urbg() % v.size();
+                                a[i] = a[j];
+                                v[i] = v[j];
+                        }
+                        }
+                }
+                check(a, v, urbg);
+
+                // Shrinking and regrowing leaves only empty sets behind.
+                auto const m = urbg() % v.size();
+                a.resize(m);
+                v.resize(m);
+                a.resize(n);
+                v.resize(n);
+                check(a, v, urbg);
+                BOOST_CHECK(T(v).counts() == a.counts());
+        }
+        typename T::const_reference r = a[0];
+        BOOST_CHECK(r == v[0]);
+        a.clear();
+        BOOST_CHECK(a.empty());
+        BOOST_CHECK(T(3).counts() == std::vector<std::size_t>(3));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,190 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit_set_hash_table.hpp>  // bit_set_hash_map, bit_set_hash_set
+#include <xstd/bit_set.hpp>             // bit_set
+#include <boost/mp11/list.hpp>          // mp_list
+#include <boost/test/unit_test.hpp>     // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK, BOOST_CHECK_EQUAL, BOOST_CHECK_LE
+#include <algorithm>                    // min
+#include <cstddef>                      // size_t
+#include <cstdint>                      // uint8_t, uint16_t, uint32_t, uint64_t
+#include <map>                          // map
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+#include <set>                          // set
+#include <string>                       // string, to_string
+#include <utility>                      // as_const
+
+BOOST_AUTO_TEST_SUITE(BitSetHashTable)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       bit_set_hash_set<  1, uint8_t>
+,       bit_set_hash_set< 10, uint8_t>
+,       bit_set_hash_set< 64, uint16_t>
+,       bit_set_hash_set<100, uint32_t>
+,       bit_set_hash_set<512, uint64_t>
+>;
+
+// Random sets over a small number of elements (many repeated keys), or over
+// all elements (few repeated keys).
+template<class S>
+auto random_key(auto& urbg)
+{
+        auto s = S();
+        auto const n = urbg() % 2 ? std::min(S::max_size(), 12uz) : S::max_size();
+        for (auto i : std::views::iota(0uz, n)) {
+                if (urbg() % 2) {
+                        s.insert(i);
+                }
+        }
+        return s;
+}
+
+// Checks size, membership of all reference keys, and iteration over exactly
+// the reference keys.
+template<class T, class Reference>
+void check(T const& t, Reference const& ref)
+{
+        BOOST_CHECK_EQUAL(t.size(), ref.size());
+        BOOST_CHECK_EQUAL(t.empty(), ref.empty());
+        BOOST_CHECK_LE(t.size(), t.capacity());
+        for (auto const& key : ref) {
+                BOOST_CHECK(t.contains(key));
+                BOOST_CHECK(t.find(key) != t.end());
+        }
+        auto seen = Reference();
+        for (auto const& key : t) {
+                BOOST_CHECK(seen.insert(key).second);
+        }
+        BOOST_CHECK(seen == ref);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Set, T, Types)
+{
+        using S = typename T::key_type;
+        auto urbg = std::mt19937_64(S::max_size());
+        auto t = T();
+        auto ref = std::set<S>();
+        check(t, ref);
+        for (auto step : std::views::iota(0, 20000)) {
+                auto const key = random_key<S>(urbg);
+                switch (urbg() % 8) {
+                case 0: case 1: case 2: {
+                        auto const [ it, inserted ] = t.insert(key);
+                        BOOST_CHECK_EQUAL(inserted, ref.insert(key).second);
+                        BOOST_CHECK(*it == key);
+                        break;
+                }
+                case 3: case 4:
+                        BOOST_CHECK_EQUAL(t.erase(key), ref.erase(key));
+                        break;
+                case 5:
+                        BOOST_CHECK_EQUAL(t.contains(key), ref.contains(key));
+                        BOOST_CHECK_EQUAL(t.count(key), ref.count(key));
+                        break;
+                case 6:
+                        if (urbg() % 64 == 0) {
+                                t.clear();
+                                ref.clear();
+                        }
+                        break;
+                default:
+                        if (urbg() % 64 == 0) {
+                                t.reserve(ref.size() + urbg() % 1000);
+                        }
+                        break;
+                }
+                if (step % 1000 == 0) {
+                        check(t, ref);
+                }
+        }
+        check(t, ref);
+}
+
+// Inserting and erasing distinct keys at a constant size leaves tombstones
+// behind, which are cleaned up in place instead of growing the table.
+BOOST_AUTO_TEST_CASE(Tombstones)
+{
+        // The binary representation of i as a set.
+        auto key = [](std::size_t i) {
+                auto s = bit_set<64>();
+                for (auto b : std::views::iota(0uz, 64uz)) {
+                        if (i >> b & 1) {
+                                s.insert(b);
+                        }
+                }
+                return s;
+        };
+        auto t = bit_set_hash_set<64>();
+        for (auto i : std::views::iota(0uz, 100uz)) {
+                BOOST_CHECK(t.insert(key(i)).second);
+        }
+        for (auto i : std::views::iota(100uz, 100000uz)) {
+                BOOST_CHECK(t.insert(key(i)).second);
+                BOOST_CHECK_EQUAL(t.erase(key(i - 100)), 1);
+        }
+        BOOST_CHECK_EQUAL(t.size(), 100);
+        BOOST_CHECK_LE(t.capacity(), 256);
+        for (auto i : std::views::iota(100000uz - 100, 100000uz)) {
+                BOOST_CHECK(t.contains(key(i)));
+        }
+}
+
+BOOST_AUTO_TEST_CASE(Map)
+{
+        using S = bit_set<100>;
+        auto urbg = std::mt19937_64(1);
+        auto t = bit_set_hash_map<100, std::string>();
+        auto ref = std::map<S, std::string>();
+        for ([[maybe_unused]] auto _ : std::views::iota(0, 20000)) {
+                auto const key = random_key<S>(urbg);
+                auto const value = std::to_string(urbg() % 1000);
+                switch (urbg() % 5) {
+                case 0: {
+                        auto const [ it, inserted ] = t.try_emplace(key, value);
+                        BOOST_CHECK_EQUAL(inserted, ref.try_emplace(key, value).second);
+                        BOOST_CHECK((*it).first == key);
+                        BOOST_CHECK_EQUAL((*it).second, ref[key]);
+                        break;
+                }
+                case 1: {
+                        auto const [ it, inserted ] = t.insert_or_assign(key, value);
+                        BOOST_CHECK_EQUAL(inserted, ref.insert_or_assign(key, value).second);
+                        BOOST_CHECK_EQUAL((*it).second, value);
+                        break;
+                }
+                case 2:
+                        t[key] += "x";
+                        ref[key] += "x";
+                        break;
+                case 3:
+                        BOOST_CHECK_EQUAL(t.erase(key), ref.erase(key));
+                        break;
+                default:
+                        if (auto const it = t.find(key); it != t.end()) {
+                                BOOST_CHECK_EQUAL((*it).second, ref.at(key));
+                        } else {
+                                BOOST_CHECK(not ref.contains(key));
+                        }
+                        break;
+                }
+        }
+        BOOST_CHECK_EQUAL(t.size(), ref.size());
+        auto seen = std::map<S, std::string>();
+        for (auto [ key, value ] : t) {
+                BOOST_CHECK(seen.emplace(key, value).second);
+        }
+        BOOST_CHECK(seen == ref);
+        for (auto [ key, value ] : t) {
+                value = "y";
+        }
+        for (auto const& [ key, value ] : std::as_const(t)) {
+                BOOST_CHECK_EQUAL(value, "y");
+        }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,73 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <set/random.hpp>               // random_set
+#include <xstd/bit_slices.hpp>          // bit_slices
+#include <boost/mp11/list.hpp>          // mp_list
+#include <boost/test/unit_test.hpp>     // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK, BOOST_CHECK_EQUAL
+#include <cstddef>                      // size_t
+#include <cstdint>                      // uint8_t, uint16_t, uint32_t, uint64_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+#include <span>                         // span
+#include <vector>                       // vector
+
+BOOST_AUTO_TEST_SUITE(BitSlices)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       bit_slices<  1,   8, uint8_t>
+,       bit_slices< 20,  64, uint8_t>
+,       bit_slices< 64,  64, uint16_t>
+,       bit_slices<100, 100, uint32_t>
+,       bit_slices<300, 512, uint64_t>
+>;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Random, T, Types)
+{
+        using S = typename T::set_type;
+        using slice_type = typename T::slice_type;
+        constexpr auto N = S::max_size();
+        constexpr auto Count = slice_type::max_size();
+
+        auto urbg = std::mt19937_64(N);
+        for (auto n : { 0uz, 1uz, Count / 2 + 1, Count }) {
+                auto sets = std::vector<S>();
+                for ([[maybe_unused]] auto _ : std::views::iota(0uz, n)) {
+                        sets.push_back(random_set<S>(urbg, urbg() % 17));
+                }
+                auto const slices = T(std::span<S const>(sets));
+                BOOST_CHECK_EQUAL(slices.size(), n);
+                for (auto i : std::views::iota(0uz, N)) {
+                        for (auto s : std::views::iota(0uz, Count)) {
+                                BOOST_CHECK_EQUAL(slices[i].contains(s), s < n and sets[s].contains(i));
+                        }
+                }
+
+                for ([[maybe_unused]] auto _ : std::views::iota(0, 20)) {
+                        auto const i = urbg() % N, j = urbg() % N, k = urbg() % N;
+                        auto const q = S{ i, j, k };
+                        auto all = slice_type();
+                        auto any = slice_type();
+                        for (auto s : std::views::iota(0uz, n)) {
+                                if (q.is_subset_of(sets[s])) {
+                                        all.insert(s);
+                                }
+                                if (q.intersects(sets[s])) {
+                                        any.insert(s);
+                                }
+                        }
+                        BOOST_CHECK(slices.containing_all({ i, j, k }) == all);
+                        BOOST_CHECK(slices.containing_any({ i, j, k }) == any);
+                        BOOST_CHECK(slices.containing_all(q) == all);
+                        BOOST_CHECK(slices.containing_any(q) == any);
+                }
+                BOOST_CHECK_EQUAL(slices.containing_all({}).size(), n);
+                BOOST_CHECK(slices.containing_any({}).empty());
+        }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
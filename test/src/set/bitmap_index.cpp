@@ -0,0 +1,106 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <opt/set/bitmap_index.hpp>     // bitmap_encoding, bitmap_index
+#include <boost/mp11/list.hpp>          // mp_list
+#include <boost/test/unit_test.hpp>     // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK, BOOST_CHECK_EQUAL, BOOST_CHECK_THROW
+#include <cstddef>                      // size_t
+#include <cstdint>                      // uint8_t, uint32_t, uint64_t
+#include <functional>                   // function
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+#include <stdexcept>                    // length_error
+#include <string>                       // string
+#include <utility>                      // pair
+#include <vector>                       // vector
+
+BOOST_AUTO_TEST_SUITE(BitmapIndex)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       bitmap_index<int,  50, uint8_t>
+,       bitmap_index<int, 100, uint32_t>
+,       bitmap_index<int, 300, uint64_t>
+>;
+
+// A random predicate, both as a query and as a reference function of the value.
+template<class Index>
+auto random_predicate(Index const& index, auto& urbg, int depth)
+        -> std::pair<typename Index::query, std::function<bool(int)>>
+{
+        auto value = [&]() { return static_cast<int>(urbg() % 12) - 1; };
+        switch (depth > 0 ? urbg() % 6 : urbg() % 3) {
+        case 0: {
+                auto const v = value();
+                return { index.equal(v), [=](int x) { return x == v; } };
+        }
+        case 1: {
+                auto const u = value(), v = value(), w = value();
+                return { index.in({ u, v, w }), [=](int x) { return x == u or x == v or x == w; } };
+        }
+        case 2: {
+                auto const lo = value(), hi = value();
+                return { index.between(lo, hi), [=](int x) { return lo <= x and x <= hi; } };
+        }
+        case 3: {
+                auto [ q, f ] = random_predicate(index, urbg, depth - 1);
+                return { ~q, [=](int x) { return not f(x); } };
+        }
+        case 4: {
+                auto [ q, f ] = random_predicate(index, urbg, depth - 1);
+                auto [ r, g ] = random_predicate(index, urbg, depth - 1);
+                return { q & r, [=](int x) { return f(x) and g(x); } };
+        }
+        default: {
+                auto [ q, f ] = random_predicate(index, urbg, depth - 1);
+                auto [ r, g ] = random_predicate(index, urbg, depth - 1);
+                return { q | r, [=](int x) { return f(x) or g(x); } };
+        }
+        }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Random, T, Types)
+{
+        auto urbg = std::mt19937_64(T::set_type::max_size());
+        for ([[maybe_unused]] auto _ : std::views::iota(0, 50)) {
+                auto column = std::vector<int>(urbg() % (T::set_type::max_size() + 1));
+                for (auto& x : column) {
+                        x = static_cast<int>(urbg() % 10);
+                }
+                for (auto encoding : { bitmap_encoding::equality, bitmap_encoding::range }) {
+                        auto const index = T(column, encoding);
+                        BOOST_CHECK_EQUAL(index.size(), column.size());
+                        for ([[maybe_unused]] auto __ : std::views::iota(0, 20)) {
+                                auto const [ q, f ] = random_predicate(index, urbg, 3);
+                                auto expected = std::vector<std::size_t>();
+                                for (auto r : std::views::iota(0uz, column.size())) {
+                                        if (f(column[r])) {
+                                                expected.push_back(r);
+                                        }
+                                }
+                                auto const rows = index.rows(q);
+                                BOOST_CHECK(rows == expected);
+                                BOOST_CHECK_EQUAL(index.count(q), expected.size());
+                                auto const result = index.evaluate(q);
+                                BOOST_CHECK(std::vector<std::size_t>(result.begin(), result.end()) == expected);
+                        }
+                }
+        }
+}
+
+BOOST_AUTO_TEST_CASE(Strings)
+{
+        auto const column = std::vector<std::string>{ "nl", "de", "fr", "nl", "be", "de", "nl" };
+        auto const index = bitmap_index<std::string, 64>(column, bitmap_encoding::range);
+        BOOST_CHECK_EQUAL(index.distinct(), 4uz);
+        BOOST_CHECK(index.rows(index.equal("nl")) == (std::vector{ 0uz, 3uz, 6uz }));
+        BOOST_CHECK(index.rows(index.between("c", "g")) == (std::vector{ 1uz, 2uz, 5uz }));
+        BOOST_CHECK(index.rows(~index.in({ "nl", "de" }) & ~index.equal("it")) == (std::vector{ 2uz, 4uz }));
+        BOOST_CHECK_EQUAL(index.count(index.equal("it") | index.equal("be")), 1uz);
+        BOOST_CHECK_THROW((bitmap_index<std::string, 4>(column)), std::length_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,101 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <opt/set/clique.hpp>           // dsatur_coloring, is_clique, is_proper_coloring, make_graph, make_random_graph, max_clique
+#include <xstd/bit_set.hpp>             // bit_set
+#include <boost/mp11/list.hpp>          // mp_list
+#include <boost/test/unit_test.hpp>     // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK, BOOST_CHECK_EQUAL, BOOST_CHECK_GE
+#include <algorithm>                    // max, min
+#include <array>                        // array
+#include <cstddef>                      // size_t
+#include <cstdint>                      // uint8_t, uint64_t
+#include <random>                       // mt19937
+#include <ranges>                       // iota
+#include <utility>                      // pair
+#include <vector>                       // vector
+
+BOOST_AUTO_TEST_SUITE(Clique)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       bit_set< 16, uint8_t>
+,       bit_set< 17, uint8_t>
+,       bit_set< 64, uint64_t>
+,       bit_set<100, uint64_t>
+>;
+
+template<class X>
+auto brute_force_clique_size(std::vector<X> const& adj)
+{
+        auto const n = adj.size();
+        auto best = 0uz;
+        for (auto mask : std::views::iota(0uz, 1uz << n)) {
+                X clique;
+                for (auto v : std::views::iota(0uz, n)) {
+                        if ((mask >> v) & 1uz) {
+                                clique.insert(v);
+                        }
+                }
+                if (clique.size() > best and is_clique(adj, clique)) {
+                        best = clique.size();
+                }
+        }
+        return best;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Petersen, T, Types)
+{
+        auto const edges = std::array<std::pair<std::size_t, std::size_t>, 15>
+        {{
+                {0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 0},
+                {0, 5}, {1, 6}, {2, 7}, {3, 8}, {4, 9},
+                {5, 7}, {7, 9}, {9, 6}, {6, 8}, {8, 5}
+        }};
+        auto const adj = make_graph<T>(10, edges);
+
+        auto const clique = max_clique(adj);
+        BOOST_CHECK(is_clique(adj, clique));
+        BOOST_CHECK_EQUAL(clique.size(), 2uz);
+
+        auto const coloring = dsatur_coloring(adj);
+        BOOST_CHECK(is_proper_coloring(adj, coloring));
+        BOOST_CHECK_EQUAL(std::ranges::max(coloring) + 1, 3uz);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Complete, T, Types)
+{
+        auto const n = std::ranges::min(T::max_size(), 12uz);
+        auto edges = std::vector<std::pair<std::size_t, std::size_t>>();
+        for (auto v : std::views::iota(0uz, n)) {
+                for (auto u : std::views::iota(0uz, v)) {
+                        edges.emplace_back(u, v);
+                }
+        }
+        auto const adj = make_graph<T>(n, edges);
+
+        BOOST_CHECK_EQUAL(max_clique(adj).size(), n);
+        BOOST_CHECK_EQUAL(std::ranges::max(dsatur_coloring(adj)) + 1, n);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Random, T, Types)
+{
+        auto urbg = std::mt19937(42);
+        for (auto density : { 0.1, 0.3, 0.5, 0.7, 0.9 }) {
+                for ([[maybe_unused]] auto _ : std::views::iota(0, 4)) {
+                        auto const adj = make_random_graph<T>(12, density, urbg);
+
+                        auto const clique = max_clique(adj);
+                        BOOST_CHECK(is_clique(adj, clique));
+                        BOOST_CHECK_EQUAL(clique.size(), brute_force_clique_size(adj));
+
+                        auto const coloring = dsatur_coloring(adj);
+                        BOOST_CHECK(is_proper_coloring(adj, coloring));
+                        BOOST_CHECK_GE(std::ranges::max(coloring) + 1, clique.size());
+                }
+        }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
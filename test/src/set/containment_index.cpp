@@ -0,0 +1,84 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <opt/set/containment_index.hpp>        // containment_index
+#include <boost/mp11/list.hpp>                  // mp_list
+#include <boost/test/unit_test.hpp>             // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK, BOOST_CHECK_EQUAL
+#include <cstddef>                              // size_t
+#include <cstdint>                              // uint8_t, uint32_t, uint64_t
+#include <random>                               // mt19937_64
+#include <ranges>                               // iota
+#include <vector>                               // vector
+
+BOOST_AUTO_TEST_SUITE(ContainmentIndex)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       containment_index< 20, uint8_t>
+,       containment_index<100, uint32_t>
+,       containment_index<300, uint64_t>
+>;
+
+// Sets with element i present with probability density / (i % 8 + 1) / 16,
+// so that elements differ widely in frequency.
+template<class S>
+auto random_set(auto& urbg, std::size_t density)
+{
+        auto s = S();
+        for (auto i : std::views::iota(0uz, S::max_size())) {
+                if (urbg() % (16 * (i % 8 + 1)) < density) {
+                        s.insert(i);
+                }
+        }
+        return s;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Random, T, Types)
+{
+        using S = typename T::set_type;
+        auto urbg = std::mt19937_64(S::max_size());
+        auto index = T();
+        auto sets = std::vector<S>();
+        for (auto batch : { 0uz, 1uz, 5uz, 300uz, 1000uz }) {
+                auto added = std::vector<S>();
+                for ([[maybe_unused]] auto _ : std::views::iota(0uz, batch)) {
+                        added.push_back(random_set<S>(urbg, urbg() % 17));
+                }
+                if (batch == 5) {
+                        for (auto const& s : added) {
+                                BOOST_CHECK_EQUAL(index.insert(s), sets.size());
+                                sets.push_back(s);
+                        }
+                } else {
+                        index.insert(added);
+                        sets.insert(sets.end(), added.begin(), added.end());
+                }
+                BOOST_CHECK_EQUAL(index.size(), sets.size());
+
+                for ([[maybe_unused]] auto _ : std::views::iota(0, 50)) {
+                        auto q = random_set<S>(urbg, urbg() % 17);
+                        if (not sets.empty() and urbg() % 2) {
+                                auto const& s = sets[urbg() % sets.size()];
+                                q = urbg() % 2 ? s & q : s | q;
+                        }
+                        auto expected_supersets = std::vector<std::size_t>();
+                        auto expected_subsets = std::vector<std::size_t>();
+                        for (auto id : std::views::iota(0uz, sets.size())) {
+                                if (q.is_subset_of(sets[id])) {
+                                        expected_supersets.push_back(id);
+                                }
+                                if (sets[id].is_subset_of(q)) {
+                                        expected_subsets.push_back(id);
+                                }
+                        }
+                        BOOST_CHECK(index.supersets(q) == expected_supersets);
+                        BOOST_CHECK(index.subsets(q) == expected_subsets);
+                }
+        }
+        BOOST_CHECK(T(sets).supersets(S()) == index.supersets(S()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
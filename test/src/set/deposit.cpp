@@ -0,0 +1,90 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <set/random.hpp>               // random_set
+#include <xstd/bit_set.hpp>             // bit_set, deposit, extract
+#include <boost/mp11/list.hpp>          // mp_list
+#include <boost/test/unit_test.hpp>     // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK
+#include <cstddef>                      // size_t
+#include <cstdint>                      // uint8_t, uint16_t, uint32_t, uint64_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+
+BOOST_AUTO_TEST_SUITE(Deposit)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       bit_set<  0, uint8_t>
+,       bit_set<  1, uint8_t>
+,       bit_set<  8, uint8_t>
+,       bit_set<  9, uint8_t>
+,       bit_set< 24, uint8_t>
+,       bit_set< 31, uint16_t>
+,       bit_set< 32, uint32_t>
+,       bit_set< 63, uint64_t>
+,       bit_set< 64, uint64_t>
+,       bit_set< 65, uint32_t>
+,       bit_set<100, uint64_t>
+,       bit_set<300, uint64_t>
+#if defined(__GNUG__)
+,       bit_set<200, __uint128_t>
+#endif
+>;
+
+// The per-bit definitions of pdep/pext in terms of the i-th element of mask.
+template<class X>
+auto reference_deposit(X const& src, X const& mask)
+{
+        X nrv;
+        auto i = 0uz;
+        for (std::size_t x : mask) {
+                if (src.contains(i++)) {
+                        nrv.insert(x);
+                }
+        }
+        return nrv;
+}
+
+template<class X>
+auto reference_extract(X const& src, X const& mask)
+{
+        X nrv;
+        auto i = 0uz;
+        for (std::size_t x : mask) {
+                if (src.contains(x)) {
+                        nrv.insert(i);
+                }
+                ++i;
+        }
+        return nrv;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Random, T, Types)
+{
+        auto urbg = std::mt19937_64(T::max_size());
+        for (auto density : { 0u, 1u, 2u, 3u, 4u }) {
+                for ([[maybe_unused]] auto _ : std::views::iota(0, 100)) {
+                        auto const src  = random_set<T>(urbg, 8);
+                        auto const mask = random_set<T>(urbg, 4 * density);
+                        BOOST_CHECK(deposit(src, mask) == reference_deposit(src, mask));
+                        BOOST_CHECK(extract(src, mask) == reference_extract(src, mask));
+                        BOOST_CHECK(deposit(extract(src, mask), mask) == (src & mask));
+                        BOOST_CHECK(extract(deposit(src, mask), mask).is_subset_of(src));
+                }
+        }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Constexpr, T, Types)
+{
+        constexpr auto empty = T();
+        constexpr auto full  = ~T();
+        static_assert(deposit(full, full) == full);
+        static_assert(extract(full, full) == full);
+        static_assert(deposit(full, empty) == empty);
+        static_assert(extract(empty, full) == empty);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
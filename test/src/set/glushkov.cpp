@@ -0,0 +1,128 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <opt/set/glushkov.hpp>         // glushkov_matcher
+#include <boost/mp11/list.hpp>          // mp_list
+#include <boost/test/unit_test.hpp>     // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK, BOOST_CHECK_EQUAL, BOOST_CHECK_THROW
+#include <algorithm>                    // min
+#include <cstddef>                      // ptrdiff_t, size_t
+#include <cstdint>                      // uint8_t, uint32_t, uint64_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+#include <regex>                        // regex, regex_match
+#include <span>                         // span
+#include <stdexcept>                    // invalid_argument, length_error
+#include <string>                       // string
+#include <string_view>                  // string_view
+#include <utility>                      // pair
+#include <vector>                       // vector
+
+BOOST_AUTO_TEST_SUITE(Glushkov)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       glushkov_matcher< 64, uint8_t>
+,       glushkov_matcher<100, uint32_t>
+,       glushkov_matcher<256, uint64_t>
+>;
+
+using matches = std::vector<std::pair<std::size_t, std::size_t>>;
+
+// Random rules over the alphabet {a, b, c} in the common syntax of std::regex.
+std::string random_rule(auto& urbg, int depth)
+{
+        auto atom = std::string();
+        switch (depth > 0 ? urbg() % 8 : urbg() % 4) {
+        case 0: case 1: atom = std::string(1, static_cast<char>('a' + urbg() % 3)); break;
+        case 2: atom = "."; break;
+        case 3: atom = urbg() % 2 ? "[ab]" : "[^a]"; break;
+        case 4: case 5: atom = random_rule(urbg, depth - 1) + random_rule(urbg, depth - 1); break;
+        default: atom = "(" + random_rule(urbg, depth - 1) + "|" + random_rule(urbg, depth - 1) + ")"; break;
+        }
+        if (atom.find_first_of("*+?") != std::string::npos) {
+                return atom;    // no nested quantifiers, on which std::regex backtracks exponentially
+        }
+        switch (urbg() % 6) {
+        case 0: return "(" + atom + ")*";
+        case 1: return "(" + atom + ")+";
+        case 2: return "(" + atom + ")?";
+        default: return atom;
+        }
+}
+
+// Every rule at every end position, by matching every substring.
+auto reference_matches(std::vector<std::string> const& rules, std::string const& text)
+{
+        auto result = matches();
+        for (auto end : std::views::iota(1uz, text.size() + 1)) {
+                for (auto r : std::views::iota(0uz, rules.size())) {
+                        auto const re = std::regex(rules[r]);
+                        for (auto first : std::views::iota(0uz, end)) {
+                                if (std::regex_match(text.begin() + static_cast<std::ptrdiff_t>(first), text.begin() + static_cast<std::ptrdiff_t>(end), re)) {
+                                        result.emplace_back(end, r);
+                                        break;
+                                }
+                        }
+                }
+        }
+        return result;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Random, T, Types)
+{
+        auto urbg = std::mt19937_64(42);
+        for ([[maybe_unused]] auto _ : std::views::iota(0, 100)) {
+                auto rules = std::vector<std::string>();
+                while (rules.size() < 3) {
+                        auto rule = random_rule(urbg, 3);
+                        if (not std::regex_match("", std::regex(rule))) {
+                                rules.push_back(rule);
+                        }
+                }
+                auto matcher = T(rules);
+                auto text = std::string(urbg() % 40, 'a');
+                for (auto& c : text) {
+                        c = static_cast<char>('a' + urbg() % 3);
+                }
+
+                // Feed the text in random chunks: matches straddle chunk boundaries.
+                auto result = matches();
+                for (auto first = 0uz; first < text.size();) {
+                        auto const last = std::min(text.size(), first + urbg() % 10);
+                        for (auto m : matcher.feed(std::span(text.data() + first, last - first))) {
+                                result.push_back(m);
+                        }
+                        first = last;
+                }
+                BOOST_CHECK(result == reference_matches(rules, text));
+        }
+}
+
+BOOST_AUTO_TEST_CASE(Examples)
+{
+        auto matcher = glushkov_matcher<128>({ "(ERROR|FATAL): .*timeout", "user=\\w+ (login|logout)", "[0-9]+ms" });
+        BOOST_CHECK_EQUAL(matcher.size(), 20uz + 18uz + 3uz);
+        BOOST_CHECK(matcher.feed(std::string_view("ERROR: db timeout\n")) == (matches{ { 17, 0 } }));
+        BOOST_CHECK(matcher.feed(std::string_view("user=bob login in 12ms")) == (matches{ { 32, 1 }, { 40, 2 } }));
+        BOOST_CHECK_EQUAL(matcher.position(), 40uz);
+
+        matcher.reset();
+        BOOST_CHECK(matcher.feed(std::string_view("FATAL: ")).empty());
+        BOOST_CHECK(matcher.feed(std::string_view("timeout")) == (matches{ { 14, 0 } }));
+
+        BOOST_CHECK_THROW(glushkov_matcher<64>({ "a*" }), std::invalid_argument);
+        BOOST_CHECK_THROW(glushkov_matcher<64>({ "(ab" }), std::invalid_argument);
+        BOOST_CHECK_THROW(glushkov_matcher<64>({ "ab)" }), std::invalid_argument);
+        BOOST_CHECK_THROW(glushkov_matcher<64>({ "*a" }), std::invalid_argument);
+        BOOST_CHECK_THROW(glushkov_matcher<64>({ "[ab" }), std::invalid_argument);
+        BOOST_CHECK_THROW(glushkov_matcher<4>({ "abcde" }), std::length_error);
+
+        // A single state, which the state set can't be shifted past.
+        BOOST_CHECK(glushkov_matcher<1>({ "a" }).feed(std::string_view("aba")) == (matches{ { 1, 0 }, { 3, 0 } }));
+        BOOST_CHECK(glushkov_matcher<1>({ "a+" }).feed(std::string_view("aab")) == (matches{ { 1, 0 }, { 2, 0 } }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
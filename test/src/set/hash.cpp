@@ -0,0 +1,182 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit/hash.hpp>            // hash
+#include <xstd/bit_set.hpp>             // bit_set
+#include <xstd/bitset.hpp>              // bitset
+#include <boost/mp11/list.hpp>          // mp_list
+#include <boost/test/unit_test.hpp>     // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK, BOOST_CHECK_EQUAL, BOOST_CHECK_LE
+#include <algorithm>                    // adjacent_find, max, sort
+#include <array>                        // array
+#include <cstddef>                      // size_t
+#include <cstdint>                      // uint8_t, uint16_t, uint32_t, uint64_t
+#include <functional>                   // hash
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+#include <span>                         // span
+#include <vector>                       // vector
+
+BOOST_AUTO_TEST_SUITE(Hash)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       bit_set<  1, uint8_t>
+,       bit_set< 20, uint16_t>
+,       bit_set< 64, uint64_t>
+,       bit_set<100, uint32_t>
+,       bit_set<200, uint64_t>
+,       bit_set<512, uint64_t>
+#if defined(__GNUG__)
+,       bit_set<300, __uint128_t>
+#endif
+>;
+
+// The empty set, all sets of one or two elements, and all intervals.
+template<class S>
+auto structured_sets()
+{
+        constexpr auto N = S::max_size();
+        auto sets = std::vector<S>{ S() };
+        for (auto i : std::views::iota(0uz, N)) {
+                auto singleton = S();
+                singleton.insert(i);
+                sets.push_back(singleton);
+                auto interval = singleton;
+                for (auto j : std::views::iota(i + 1, N)) {
+                        auto pair = singleton;
+                        pair.insert(j);
+                        sets.push_back(pair);
+                        interval.insert(j);
+                        if (j > i + 1) {
+                                sets.push_back(interval);
+                        }
+                }
+        }
+        return sets;
+}
+
+template<class S>
+auto hashes(std::vector<S> const& sets)
+{
+        auto nrv = std::vector<std::size_t>();
+        for (auto const& s : sets) {
+                nrv.push_back(std::hash<S>()(s));
+        }
+        return nrv;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(NoCollisions, T, Types)
+{
+        auto h = hashes(structured_sets<T>());
+        std::ranges::sort(h);
+        BOOST_CHECK(std::ranges::adjacent_find(h) == h.end());
+}
+
+// The lowest and the highest bits of the hashes spread the sets evenly over
+// 256 buckets, as used by power-of-two tables (e.g. the bucket from the low
+// bits and a tag from the high bits).
+BOOST_AUTO_TEST_CASE_TEMPLATE(Buckets, T, Types)
+{
+        auto const h = hashes(structured_sets<T>());
+        if (h.size() < 256 * 16) {
+                return;
+        }
+        auto lo = std::array<std::size_t, 256>();
+        auto hi = std::array<std::size_t, 256>();
+        for (auto x : h) {
+                ++lo[x & 0xFF];
+                ++hi[static_cast<std::uint64_t>(x) >> 56];
+        }
+        auto const expected = h.size() / 256;
+        BOOST_CHECK_LE(std::ranges::max(lo), 2 * expected);
+        BOOST_CHECK_LE(std::ranges::max(hi), 2 * expected);
+}
+
+// Flipping any one input bit flips each output bit with probability close to
+// one half (for sets large enough to have more than a few dozen of them).
+BOOST_AUTO_TEST_CASE_TEMPLATE(Avalanche, T, Types)
+{
+        constexpr auto N = T::max_size();
+        if (N < 16) {
+                return;
+        }
+        auto urbg = std::mt19937_64(N);
+        auto flips = std::array<std::size_t, 64>();
+        auto trials = 0uz;
+        for ([[maybe_unused]] auto _ : std::views::iota(0, 50)) {
+                auto s = T();
+                for (auto i : std::views::iota(0uz, N)) {
+                        if (urbg() % 2) {
+                                s.insert(i);
+                        }
+                }
+                auto const x = static_cast<std::uint64_t>(std::hash<T>()(s));
+                for (auto i : std::views::iota(0uz, N)) {
+                        auto t = s;
+                        t.complement(i);
+                        auto const d = x ^ static_cast<std::uint64_t>(std::hash<T>()(t));
+                        for (auto b : std::views::iota(0uz, flips.size())) {
+                                flips[b] += d >> b & 1;
+                        }
+                        ++trials;
+                }
+        }
+        for (auto f : flips) {
+                BOOST_CHECK_LE(f, trials * 6 / 10 + 10);
+                BOOST_CHECK_LE(trials * 4 / 10, f + 10);
+        }
+}
+
+// The hash depends on the elements only, not on the block type.
+BOOST_AUTO_TEST_CASE(BlockIndependent)
+{
+        auto urbg = std::mt19937_64(1);
+        for ([[maybe_unused]] auto _ : std::views::iota(0, 100)) {
+                auto s8  = bit_set<200, uint8_t>();
+                auto s32 = bit_set<200, uint32_t>();
+                auto s64 = bit_set<200, uint64_t>();
+                for (auto i : std::views::iota(0uz, 200uz)) {
+                        if (urbg() % 3 == 0) {
+                                s8.insert(i);
+                                s32.insert(i);
+                                s64.insert(i);
+                        }
+                }
+                BOOST_CHECK_EQUAL(std::hash<decltype(s8)>()(s8), std::hash<decltype(s64)>()(s64));
+                BOOST_CHECK_EQUAL(std::hash<decltype(s32)>()(s32), std::hash<decltype(s64)>()(s64));
+        }
+}
+
+BOOST_AUTO_TEST_CASE(Seeded)
+{
+        auto const blocks = std::array<uint64_t, 4>{ 1, 2, 3, 4 };
+        auto const h = std::vector{ bit::hash(std::span(blocks)), bit::hash(std::span(blocks), 1), bit::hash(std::span(blocks), 2) };
+        BOOST_CHECK_EQUAL(h[0], bit::hash(std::span(blocks), 0));
+        BOOST_CHECK(h[0] != h[1] and h[0] != h[2] and h[1] != h[2]);
+}
+
+BOOST_AUTO_TEST_CASE(Bitset)
+{
+        auto h = std::vector<std::size_t>();
+        for (auto i : std::views::iota(0uz, 200uz)) {
+                for (auto j : std::views::iota(i, 200uz)) {
+                        auto b = xstd::bitset<200>();
+                        b.set(i);
+                        b.set(j);
+                        h.push_back(std::hash<xstd::bitset<200>>()(b));
+                }
+        }
+        std::ranges::sort(h);
+        BOOST_CHECK(std::ranges::adjacent_find(h) == h.end());
+}
+
+BOOST_AUTO_TEST_CASE(Constexpr)
+{
+        static_assert(std::hash<bit_set<100>>()(bit_set<100>{ 1, 2, 3 }) != std::hash<bit_set<100>>()(bit_set<100>{ 1, 2, 4 }));
+        static_assert(std::hash<bit_set<64>>()(bit_set<64>()) != std::hash<bit_set<64>>()(bit_set<64>{ 0 }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,72 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <set/random.hpp>               // random_set
+#include <xstd/bit_set.hpp>             // bit_set, deinterleave2, deinterleave3, interleave2, interleave3
+#include <boost/mp11/list.hpp>          // mp_list
+#include <boost/test/unit_test.hpp>     // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK
+#include <cstddef>                      // size_t
+#include <cstdint>                      // uint8_t, uint16_t, uint32_t, uint64_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+
+BOOST_AUTO_TEST_SUITE(Interleave)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       bit_set<  0, uint8_t>
+,       bit_set<  1, uint8_t>
+,       bit_set<  5, uint8_t>
+,       bit_set<  8, uint8_t>
+,       bit_set< 17, uint8_t>
+,       bit_set< 21, uint64_t>
+,       bit_set< 22, uint64_t>
+,       bit_set< 43, uint64_t>
+,       bit_set< 64, uint64_t>
+,       bit_set< 65, uint32_t>
+,       bit_set<100, uint16_t>
+,       bit_set<300, uint64_t>
+#if defined(__GNUG__)
+,       bit_set<200, __uint128_t>
+#endif
+>;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Random, T, Types)
+{
+        auto urbg = std::mt19937_64(T::max_size());
+        for ([[maybe_unused]] auto _ : std::views::iota(0, 100)) {
+                auto const x = random_set<T>(urbg, 8);
+                auto const y = random_set<T>(urbg, 8);
+                auto const z = random_set<T>(urbg, 8);
+                auto const xy  = interleave2(x, y);
+                auto const xyz = interleave3(x, y, z);
+                BOOST_CHECK(xy.size()  == x.size() + y.size());
+                BOOST_CHECK(xyz.size() == x.size() + y.size() + z.size());
+                for (auto i : std::views::iota(0uz, T::max_size())) {
+                        BOOST_CHECK(xy.contains(2 * i    ) == x.contains(i));
+                        BOOST_CHECK(xy.contains(2 * i + 1) == y.contains(i));
+                        BOOST_CHECK(xyz.contains(3 * i    ) == x.contains(i));
+                        BOOST_CHECK(xyz.contains(3 * i + 1) == y.contains(i));
+                        BOOST_CHECK(xyz.contains(3 * i + 2) == z.contains(i));
+                }
+                auto const [ x2, y2 ] = deinterleave2(xy);
+                auto const [ x3, y3, z3 ] = deinterleave3(xyz);
+                BOOST_CHECK(x2 == x && y2 == y);
+                BOOST_CHECK(x3 == x && y3 == y && z3 == z);
+        }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Constexpr, T, Types)
+{
+        constexpr auto empty = T();
+        constexpr auto full  = ~T();
+        static_assert(interleave2(full, full) == ~bit_set<2 * T::max_size(), typename T::block_type>());
+        static_assert(interleave3(empty, empty, empty).empty());
+        static_assert(deinterleave2(interleave2(full, empty))[0] == full);
+        static_assert(deinterleave3(interleave3(empty, full, empty))[1] == full);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,171 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <opt/set/minhash.hpp>          // estimate, lsh_index, matches, minhash, pack
+#include <xstd/bit_set.hpp>             // bit_set
+#include <boost/mp11/list.hpp>          // mp_list
+#include <boost/test/unit_test.hpp>     // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK, BOOST_CHECK_EQUAL, BOOST_CHECK_SMALL
+#include <algorithm>                    // find, min
+#include <array>                        // array
+#include <cstddef>                      // size_t
+#include <cstdint>                      // uint8_t, uint32_t, uint64_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+#include <utility>                      // pair
+#include <vector>                       // vector
+
+BOOST_AUTO_TEST_SUITE(MinHash)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       bit_set< 50, uint8_t>
+,       bit_set<100, uint32_t>
+,       bit_set<300, uint64_t>
+>;
+
+template<class S>
+auto random_set(auto& urbg, std::size_t density)
+{
+        auto s = S();
+        for (auto i : std::views::iota(0uz, S::max_size())) {
+                if (urbg() % 16 < density) {
+                        s.insert(i);
+                }
+        }
+        return s;
+}
+
+template<class S>
+auto exact_jaccard(S const& a, S const& b)
+{
+        auto const u = (a | b).size();
+        return u == 0 ? 1.0 : static_cast<double>((a & b).size()) / static_cast<double>(u);
+}
+
+// The signature of a union is the elementwise minimum of the signatures.
+BOOST_AUTO_TEST_CASE_TEMPLATE(Union, S, Types)
+{
+        auto urbg = std::mt19937_64(S::max_size());
+        auto const h = minhash<64>(42);
+        for ([[maybe_unused]] auto _ : std::views::iota(0, 100)) {
+                auto const a = random_set<S>(urbg, urbg() % 17);
+                auto const b = random_set<S>(urbg, urbg() % 17);
+                auto expected = h(a);
+                auto const sb = h(b);
+                for (auto i : std::views::iota(0uz, expected.size())) {
+                        expected[i] = std::min(expected[i], sb[i]);
+                }
+                BOOST_CHECK(h(a | b) == expected);
+                BOOST_CHECK(h(a) == h(S(a)));
+        }
+}
+
+BOOST_AUTO_TEST_CASE(Estimate)
+{
+        using S = bit_set<4096>;
+        auto urbg = std::mt19937_64(1);
+        auto const h = minhash<1024>();
+        for ([[maybe_unused]] auto _ : std::views::iota(0, 20)) {
+                auto const a = random_set<S>(urbg, 1 + urbg() % 8);
+                auto b = a;
+                for ([[maybe_unused]] auto flip : std::views::iota(0uz, urbg() % 1024)) {
+                        b.complement(urbg() % S::max_size());
+                }
+                auto const j = exact_jaccard(a, b);
+                auto const sa = h(a);
+                auto const sb = h(b);
+                auto agree = 0uz;
+                for (auto i : std::views::iota(0uz, sa.size())) {
+                        agree += sa[i] == sb[i];
+                }
+                BOOST_CHECK_SMALL(static_cast<double>(agree) / 1024.0 - j, 0.06);
+                BOOST_CHECK_SMALL(estimate<1>(pack<1>(sa), pack<1>(sb)) - j, 0.12);
+                BOOST_CHECK_SMALL(estimate<4>(pack<4>(sa), pack<4>(sb)) - j, 0.06);
+        }
+}
+
+template<std::size_t B>
+void check_matches(auto& urbg)
+{
+        for ([[maybe_unused]] auto _ : std::views::iota(0, 100)) {
+                auto x = std::array<std::uint32_t, 128>();
+                auto y = std::array<std::uint32_t, 128>();
+                for (auto i : std::views::iota(0uz, x.size())) {
+                        x[i] = static_cast<std::uint32_t>(urbg());
+                        y[i] = urbg() % 2 ? x[i] : static_cast<std::uint32_t>(urbg());
+                }
+                auto expected = 0uz;
+                for (auto i : std::views::iota(0uz, x.size())) {
+                        expected += ((x[i] ^ y[i]) & ((std::uint64_t{1} << B) - 1)) == 0;
+                }
+                BOOST_CHECK_EQUAL(matches<B>(pack<B>(x), pack<B>(y)), expected);
+        }
+}
+
+BOOST_AUTO_TEST_CASE(Matches)
+{
+        auto urbg = std::mt19937_64(2);
+        check_matches< 1>(urbg);
+        check_matches< 2>(urbg);
+        check_matches< 4>(urbg);
+        check_matches< 8>(urbg);
+        check_matches<16>(urbg);
+        check_matches<32>(urbg);
+}
+
+using Indices = boost::mp11::mp_list
+<       lsh_index< 50, 20, 5, uint8_t>
+,       lsh_index<100, 20, 5, uint32_t>
+,       lsh_index<300, 20, 5, uint64_t>
+>;
+
+// Every reported pair is exact, and near-duplicates (J >= 0.9, missed with
+// probability (1 - 0.9^5)^20 < 1e-7) are all found.
+BOOST_AUTO_TEST_CASE_TEMPLATE(Index, T, Indices)
+{
+        using S = typename T::set_type;
+        auto urbg = std::mt19937_64(S::max_size());
+        auto sets = std::vector<S>();
+        for ([[maybe_unused]] auto _ : std::views::iota(0, 200)) {
+                if (not sets.empty() and urbg() % 4 == 0) {
+                        // A duplicate, or a near-duplicate one element apart.
+                        auto s = sets[urbg() % sets.size()];
+                        if (s.size() >= 20 and urbg() % 2) {
+                                s.complement(urbg() % S::max_size());
+                        }
+                        sets.push_back(s);
+                } else {
+                        sets.push_back(random_set<S>(urbg, 2 + urbg() % 8));
+                }
+        }
+        auto const index = T(sets);
+        BOOST_CHECK_EQUAL(index.size(), sets.size());
+
+        auto const threshold = 0.5;
+        auto const join = index.self_join(threshold);
+        for (auto const& m : join) {
+                BOOST_CHECK(m.first < m.second);
+                BOOST_CHECK(m.similarity >= threshold);
+                BOOST_CHECK_EQUAL(m.similarity, exact_jaccard(sets[m.first], sets[m.second]));
+        }
+        for (auto i : std::views::iota(0uz, sets.size())) {
+                for (auto j : std::views::iota(i + 1, sets.size())) {
+                        if (exact_jaccard(sets[i], sets[j]) >= 0.9) {
+                                BOOST_CHECK(std::ranges::find(join, typename T::match{ i, j, exact_jaccard(sets[i], sets[j]) }) != join.end());
+                        }
+                }
+        }
+
+        for (auto i : std::views::iota(0uz, sets.size())) {
+                auto const hits = index.query(sets[i], threshold);
+                BOOST_CHECK(std::ranges::find(hits, std::pair{ i, 1.0 }) != hits.end());
+                for (auto [id, similarity] : hits) {
+                        BOOST_CHECK_EQUAL(similarity, exact_jaccard(sets[i], sets[id]));
+                }
+        }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,98 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <set/random.hpp>               // random_set
+#include <opt/set/radix_sort.hpp>       // sort_bit_sets, unique_bit_sets
+#include <xstd/bit_set.hpp>             // bit_set
+#include <boost/mp11/list.hpp>          // mp_list
+#include <boost/test/unit_test.hpp>     // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK, BOOST_CHECK_EQUAL
+#include <algorithm>                    // sort, unique
+#include <cstddef>                      // size_t
+#include <cstdint>                      // uint8_t, uint16_t, uint32_t, uint64_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+#include <vector>                       // vector
+
+BOOST_AUTO_TEST_SUITE(RadixSort)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       bit_set<  1, uint8_t>
+,       bit_set<  7, uint8_t>
+,       bit_set< 20, uint16_t>
+,       bit_set< 64, uint32_t>
+,       bit_set<100, uint64_t>
+,       bit_set<300, uint64_t>
+>;
+
+// Sparse and dense sets, runs of consecutive elements (which tie on their
+// keys), and sets over the first few elements only (with many duplicates).
+template<class S>
+auto random_sets(auto& urbg, std::size_t n)
+{
+        constexpr auto N = S::max_size();
+        auto sets = std::vector<S>();
+        for ([[maybe_unused]] auto _ : std::views::iota(0uz, n)) {
+                auto s = S();
+                switch (urbg() % 4) {
+                case 0:
+                        s = random_set<S>(urbg, urbg() % 17);
+                        break;
+                case 1: {
+                        auto const first = urbg() % N;
+                        for (auto i : std::views::iota(first, first + urbg() % (N - first + 1))) {
+                                s.insert(i);
+                        }
+                        break;
+                }
+                case 2: {
+                        for (auto i : std::views::iota(0uz, std::min(N, 5uz))) {
+                                if (urbg() % 2) {
+                                        s.insert(i);
+                                }
+                        }
+                        break;
+                }
+                default:
+                        break;
+                }
+                sets.push_back(s);
+        }
+        return sets;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Sort, T, Types)
+{
+        auto urbg = std::mt19937_64(T::max_size());
+        for (auto n : { 0uz, 1uz, 2uz, 100uz, 3000uz, 20000uz }) {
+                for (auto num_threads : { 1uz, 3uz }) {
+                        auto sets = random_sets<T>(urbg, n);
+                        auto expected = sets;
+                        std::ranges::sort(expected);
+                        sort_bit_sets(sets, num_threads);
+                        BOOST_CHECK(sets == expected);
+                }
+        }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Unique, T, Types)
+{
+        auto urbg = std::mt19937_64(T::max_size());
+        for (auto n : { 0uz, 1uz, 100uz, 3000uz }) {
+                for (auto num_threads : { 1uz, 3uz }) {
+                        auto sets = random_sets<T>(urbg, n);
+                        auto expected = sets;
+                        std::ranges::sort(expected);
+                        auto const [first, last] = std::ranges::unique(expected);
+                        auto const removed = static_cast<std::size_t>(last - first);
+                        expected.erase(first, last);
+                        BOOST_CHECK_EQUAL(unique_bit_sets(sets, num_threads), removed);
+                        BOOST_CHECK(sets == expected);
+                }
+        }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
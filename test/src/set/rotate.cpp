@@ -0,0 +1,118 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <set/random.hpp>               // random_set
+#include <xstd/bit_set.hpp>             // bit_set
+#include <xstd/bitset.hpp>              // bitset
+#include <boost/mp11/list.hpp>          // mp_list
+#include <boost/test/unit_test.hpp>     // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK
+#include <cstddef>                      // size_t
+#include <cstdint>                      // uint8_t, uint16_t, uint32_t, uint64_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+
+BOOST_AUTO_TEST_SUITE(Rotate)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       bit_set<  1, uint8_t>
+,       bit_set<  5, uint8_t>
+,       bit_set<  8, uint8_t>
+,       bit_set<  9, uint8_t>
+,       bit_set< 24, uint8_t>
+,       bit_set< 40, uint16_t>
+,       bit_set< 63, uint64_t>
+,       bit_set< 64, uint64_t>
+,       bit_set< 65, uint32_t>
+,       bit_set<128, uint32_t>
+,       bit_set<256, uint64_t>
+,       bit_set<300, uint64_t>
+#if defined(__GNUG__)
+,       bit_set<120, __uint128_t>
+,       bit_set<200, __uint128_t>
+#endif
+>;
+
+using Bitsets = boost::mp11::mp_list
+<       bitset<  1, uint8_t>
+,       bitset<  9, uint8_t>
+,       bitset< 24, uint8_t>
+,       bitset< 63, uint64_t>
+,       bitset< 64, uint64_t>
+,       bitset< 65, uint32_t>
+,       bitset<128, uint32_t>
+,       bitset<300, uint64_t>
+>;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Random, T, Types)
+{
+        constexpr auto N = T::max_size();
+        auto urbg = std::mt19937_64(N);
+        for ([[maybe_unused]] auto _ : std::views::iota(0, 100)) {
+                auto const x = random_set<T>(urbg, 8);
+                auto const n = static_cast<std::size_t>(urbg() % (2 * N + 1));
+                auto l = x; l.rotl(n);
+                auto r = x; r.rotr(n);
+                auto v = x; v.reverse();
+                BOOST_CHECK(l.size() == x.size() && r.size() == x.size() && v.size() == x.size());
+                for (auto i : std::views::iota(0uz, N)) {
+                        BOOST_CHECK(l.contains((i + n) % N) == x.contains(i));
+                        BOOST_CHECK(r.contains(i) == x.contains((i + n) % N));
+                        BOOST_CHECK(v.contains(N - 1 - i) == x.contains(i));
+                }
+                BOOST_CHECK(auto(l).rotr(n) == x);
+                BOOST_CHECK(auto(v).reverse() == x);
+                if constexpr (N % 8 == 0) {
+                        auto s = x; s.byteswap();
+                        BOOST_CHECK(s.size() == x.size());
+                        for (auto i : std::views::iota(0uz, N)) {
+                                BOOST_CHECK(s.contains((N / 8 - 1 - i / 8) * 8 + i % 8) == x.contains(i));
+                        }
+                }
+        }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(RandomBitset, T, Bitsets)
+{
+        constexpr auto N = T().size();
+        auto urbg = std::mt19937_64(N);
+        for ([[maybe_unused]] auto _ : std::views::iota(0, 100)) {
+                auto x = T();
+                for (auto i : std::views::iota(0uz, N)) {
+                        x.set(i, urbg() % 2 == 1);
+                }
+                auto const n = static_cast<std::size_t>(urbg() % (2 * N + 1));
+                auto l = x; l.rotl(n);
+                auto r = x; r.rotr(n);
+                auto v = x; v.reverse();
+                BOOST_CHECK(l.count() == x.count() && r.count() == x.count() && v.count() == x.count());
+                for (auto i : std::views::iota(0uz, N)) {
+                        BOOST_CHECK(l.test((i + n) % N) == x.test(i));
+                        BOOST_CHECK(r.test(i) == x.test((i + n) % N));
+                        BOOST_CHECK(v.test(N - 1 - i) == x.test(i));
+                }
+                BOOST_CHECK(auto(l).rotr(n) == x);
+                BOOST_CHECK(auto(v).reverse() == x);
+                if constexpr (N % 8 == 0) {
+                        auto s = x; s.byteswap();
+                        BOOST_CHECK(s.count() == x.count());
+                        for (auto i : std::views::iota(0uz, N)) {
+                                BOOST_CHECK(s.test((N / 8 - 1 - i / 8) * 8 + i % 8) == x.test(i));
+                        }
+                }
+        }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Constexpr, T, Types)
+{
+        constexpr auto N = T::max_size();
+        static_assert(T({ 0uz }).rotl(N + 1) == T({ 1 % N }));
+        static_assert(T({ 0uz }).rotr(1) == T({ N - 1 }));
+        static_assert(T({ 0uz }).reverse() == T({ N - 1 }));
+        static_assert((~T()).reverse() == ~T());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
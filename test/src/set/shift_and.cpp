@@ -0,0 +1,102 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <opt/set/shift_and.hpp>        // shift_and_matcher
+#include <boost/mp11/list.hpp>          // mp_list
+#include <boost/test/unit_test.hpp>     // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK, BOOST_CHECK_EQUAL, BOOST_CHECK_THROW
+#include <algorithm>                    // min, sort
+#include <cstddef>                      // size_t
+#include <cstdint>                      // uint8_t, uint32_t, uint64_t
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+#include <span>                         // span
+#include <stdexcept>                    // invalid_argument, length_error
+#include <string>                       // string
+#include <string_view>                  // string_view
+#include <utility>                      // pair
+#include <vector>                       // vector
+
+BOOST_AUTO_TEST_SUITE(ShiftAnd)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       shift_and_matcher< 16, uint8_t>
+,       shift_and_matcher< 64, uint64_t>
+,       shift_and_matcher< 72, uint32_t>
+,       shift_and_matcher<200, uint64_t>
+>;
+
+auto random_string(auto& urbg, std::size_t size, std::size_t alphabet)
+{
+        auto s = std::string(size, 'a');
+        for (auto& c : s) {
+                c = static_cast<char>('a' + urbg() % alphabet);
+        }
+        return s;
+}
+
+// Every pattern at every end position, by brute force.
+auto reference_matches(std::vector<std::string> const& patterns, std::string_view text)
+{
+        auto matches = std::vector<std::pair<std::size_t, std::size_t>>();
+        for (auto end : std::views::iota(1uz, text.size() + 1)) {
+                for (auto p : std::views::iota(0uz, patterns.size())) {
+                        if (patterns[p].size() <= end and text.substr(end - patterns[p].size(), patterns[p].size()) == patterns[p]) {
+                                matches.emplace_back(end, p);
+                        }
+                }
+        }
+        return matches;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Random, T, Types)
+{
+        auto urbg = std::mt19937_64(42);
+        for ([[maybe_unused]] auto _ : std::views::iota(0, 200)) {
+                auto const alphabet = 1 + urbg() % 4;
+                auto patterns = std::vector<std::string>();
+                for (auto capacity = 16uz; capacity > 0;) {
+                        auto const size = std::min(1 + urbg() % 6, capacity);
+                        patterns.push_back(random_string(urbg, size, alphabet));
+                        capacity -= size;
+                }
+                auto const text = random_string(urbg, urbg() % 500, alphabet);
+                auto matcher = T(patterns);
+
+                // Feed the text in random chunks: matches straddle chunk boundaries.
+                auto matches = std::vector<std::pair<std::size_t, std::size_t>>();
+                for (auto first = 0uz; first < text.size();) {
+                        auto const last = std::min(text.size(), first + urbg() % 20);
+                        for (auto m : matcher.feed(std::span(text.data() + first, last - first))) {
+                                matches.push_back(m);
+                        }
+                        first = last;
+                }
+                std::ranges::sort(matches);
+                BOOST_CHECK(matches == reference_matches(patterns, text));
+                BOOST_CHECK_EQUAL(matcher.position(), text.size());
+        }
+}
+
+BOOST_AUTO_TEST_CASE(Examples)
+{
+        auto matcher = shift_and_matcher<64>({ "error", "warn", "err" });
+        auto const log = std::string_view("info ok\nwarn: disk\nerror: fail\n");
+        BOOST_CHECK(matcher.feed(log) == (std::vector<std::pair<std::size_t, std::size_t>>{ { 12, 1 }, { 22, 2 }, { 24, 0 } }));
+
+        matcher.reset();
+        BOOST_CHECK(matcher.feed(std::string_view("er")).empty());
+        BOOST_CHECK(matcher.feed(std::string_view("ror")) == (std::vector<std::pair<std::size_t, std::size_t>>{ { 3, 2 }, { 5, 0 } }));
+
+        BOOST_CHECK_THROW(shift_and_matcher<8>({ "abc", "" }), std::invalid_argument);
+        BOOST_CHECK_THROW(shift_and_matcher<8>({ "abcde", "abcd" }), std::length_error);
+
+        // A single position, which the state can't be shifted past.
+        auto single = shift_and_matcher<1>({ "a" });
+        BOOST_CHECK(single.feed(std::string_view("aba")) == (std::vector<std::pair<std::size_t, std::size_t>>{ { 1, 0 }, { 3, 0 } }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,103 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <set/random.hpp>                       // random_set
+#include <opt/set/similarity_search.hpp>        // similarity, similarity_index
+#include <boost/mp11/list.hpp>                  // mp_list
+#include <boost/test/unit_test.hpp>             // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK, BOOST_CHECK_EQUAL
+#include <algorithm>                            // sort
+#include <compare>                              // is_eq, is_gt, weak_order
+#include <cstddef>                              // size_t
+#include <cstdint>                              // uint8_t, uint32_t, uint64_t
+#include <random>                               // mt19937_64
+#include <ranges>                               // iota
+#include <vector>                               // vector
+
+BOOST_AUTO_TEST_SUITE(SimilaritySearch)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       similarity_index< 20, uint8_t>
+,       similarity_index<100, uint32_t>
+,       similarity_index<300, uint64_t>
+>;
+
+// Fingerprints of widely varying densities, with duplicates so that
+// scores tie.
+template<class S>
+auto random_sets(auto& urbg, std::size_t n)
+{
+        auto sets = std::vector<S>();
+        for ([[maybe_unused]] auto _ : std::views::iota(0uz, n)) {
+                if (not sets.empty() and urbg() % 8 == 0) {
+                        sets.push_back(sets[urbg() % sets.size()]);
+                        continue;
+                }
+                sets.push_back(random_set<S>(urbg, 2 * (urbg() % 9)));
+        }
+        return sets;
+}
+
+// Scores every candidate with set algebra, and sorts them all.
+template<class Index>
+auto brute_force(std::vector<typename Index::set_type> const& sets, typename Index::set_type const& query, std::size_t k, similarity metric)
+{
+        auto constexpr N = Index::set_type::max_size();
+        auto hits = std::vector<typename Index::hit>();
+        for (auto id : std::views::iota(0uz, sets.size())) {
+                auto const c = (query & sets[id]).size();
+                auto const u = (query | sets[id]).size();
+                auto const d = (query ^ sets[id]).size();
+                auto const score = metric == similarity::hamming ?
+                        1.0 - static_cast<double>(d) / static_cast<double>(N) :
+                        u == 0 ? 1.0 : static_cast<double>(c) / static_cast<double>(u)
+                ;
+                hits.push_back({ id, score });
+        }
+        std::ranges::sort(hits, [](auto const& lhs, auto const& rhs) {
+                auto const cmp = std::weak_order(lhs.score, rhs.score);
+                return std::is_gt(cmp) or (std::is_eq(cmp) and lhs.id < rhs.id);
+        });
+        if (hits.size() > k) {
+                hits.resize(k);
+        }
+        return hits;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Random, T, Types)
+{
+        using S = typename T::set_type;
+        auto urbg = std::mt19937_64(S::max_size());
+        for (auto n : { 0uz, 1uz, 7uz, 200uz }) {
+                auto const sets = random_sets<S>(urbg, n);
+                auto const index = T(sets);
+                BOOST_CHECK_EQUAL(index.size(), n);
+                for (auto const& query : random_sets<S>(urbg, 20)) {
+                        for (auto metric : { similarity::tanimoto, similarity::hamming }) {
+                                for (auto k : { 0uz, 1uz, 5uz, 300uz }) {
+                                        auto const expected = brute_force<T>(sets, query, k, metric);
+                                        for (auto num_threads : { 1uz, 3uz }) {
+                                                BOOST_CHECK(index.top_k(query, k, metric, num_threads) == expected);
+                                        }
+                                }
+                        }
+                }
+        }
+}
+
+BOOST_AUTO_TEST_CASE(Examples)
+{
+        using S = bit_set<8>;
+        auto const sets = std::vector<S>{ S{ 0, 1, 2, 3 }, S{ 0, 1 }, S{}, S{ 4, 5, 6, 7 }, S{ 0, 1, 2, 3, 4 } };
+        auto const index = similarity_index<8>(sets);
+        using hit = decltype(index)::hit;
+
+        BOOST_CHECK(index.top_k(S{ 0, 1, 2, 3 }, 3) == (std::vector<hit>{ { 0, 1.0 }, { 4, 0.8 }, { 1, 0.5 } }));
+        BOOST_CHECK(index.top_k(S{}, 2, similarity::jaccard) == (std::vector<hit>{ { 2, 1.0 }, { 0, 0.0 } }));
+        BOOST_CHECK(index.top_k(S{ 0, 1, 2 }, 2, similarity::hamming) == (std::vector<hit>{ { 0, 0.875 }, { 1, 0.875 } }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,101 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <xstd/bit_set.hpp>             // bit_set, for_each_gray_code_subset, for_each_submask, next_combination
+#include <boost/mp11/list.hpp>          // mp_list
+#include <boost/test/unit_test.hpp>     // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK, BOOST_CHECK_EQUAL
+#include <bit>                          // popcount
+#include <cstddef>                      // size_t
+#include <cstdint>                      // uint8_t, uint16_t, uint32_t, uint64_t
+#include <ranges>                       // iota
+#include <set>                          // set
+#include <vector>                       // vector
+
+BOOST_AUTO_TEST_SUITE(Subsets)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       bit_set< 0, uint8_t>
+,       bit_set< 1, uint8_t>
+,       bit_set< 7, uint8_t>
+,       bit_set< 8, uint8_t>
+,       bit_set< 9, uint8_t>
+,       bit_set<16, uint8_t>
+,       bit_set<17, uint8_t>
+,       bit_set<16, uint16_t>
+,       bit_set<17, uint32_t>
+,       bit_set<17, uint64_t>
+#if defined(__GNUG__)
+,       bit_set<17, __uint128_t>
+#endif
+>;
+
+template<class X>
+auto from_mask(std::size_t mask)
+{
+        X x;
+        for (auto i : std::views::iota(0uz, X::max_size())) {
+                if ((mask >> i) & 1uz) {
+                        x.insert(i);
+                }
+        }
+        return x;
+}
+
+// Colexicographical order of equal-sized sets is the numeric order of their bit patterns.
+BOOST_AUTO_TEST_CASE_TEMPLATE(NextCombination, T, Types)
+{
+        constexpr auto N = T::max_size();
+        for (auto k : std::views::iota(0uz, N + 1)) {
+                auto expected = std::vector<T>();
+                for (auto mask : std::views::iota(0uz, 1uz << N)) {
+                        if (static_cast<std::size_t>(std::popcount(mask)) == k) {
+                                expected.push_back(from_mask<T>(mask));
+                        }
+                }
+                auto c = expected.front();
+                for (auto i : std::views::iota(0uz, expected.size())) {
+                        BOOST_CHECK(c == expected[i]);
+                        BOOST_CHECK_EQUAL(next_combination(c), i + 1 < expected.size());
+                }
+                BOOST_CHECK(c == expected.front());
+        }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ForEachSubmask, T, Types)
+{
+        for (auto pattern : { 0x0uz, 0x1uz, 0xbuz, 0x5a5auz, 0x1'8001uz, ~0x0uz }) {
+                auto const mask = from_mask<T>(pattern);
+                auto previous = std::vector<T>();
+                for_each_submask(mask, [&](auto const& submask) {
+                        BOOST_CHECK(submask.is_subset_of(mask));
+                        BOOST_CHECK(previous.empty() or submask != previous.back());
+                        previous.push_back(submask);
+                });
+                BOOST_CHECK_EQUAL(previous.size(), 1uz << mask.size());
+                BOOST_CHECK(previous.front() == mask);
+                BOOST_CHECK(previous.back().empty());
+                BOOST_CHECK_EQUAL(std::set(previous.begin(), previous.end()).size(), previous.size());
+        }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ForEachGrayCodeSubset, T, Types)
+{
+        for (auto pattern : { 0x0uz, 0x1uz, 0xbuz, 0x5a5auz, 0x1'8001uz, ~0x0uz }) {
+                auto const mask = from_mask<T>(pattern);
+                auto previous = std::vector<T>();
+                for_each_gray_code_subset(mask, [&](auto const& subset) {
+                        BOOST_CHECK(subset.is_subset_of(mask));
+                        BOOST_CHECK(previous.empty() or (subset ^ previous.back()).size() == 1);
+                        previous.push_back(subset);
+                });
+                BOOST_CHECK_EQUAL(previous.size(), 1uz << mask.size());
+                BOOST_CHECK(previous.front().empty());
+                BOOST_CHECK_EQUAL(std::set(previous.begin(), previous.end()).size(), previous.size());
+        }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
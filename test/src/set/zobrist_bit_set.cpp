@@ -0,0 +1,107 @@
+//          Copyright Rein Halbersma 2014-2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <set/random.hpp>               // random_set
+#include <xstd/zobrist_bit_set.hpp>     // zobrist_bit_set
+#include <xstd/bit_set.hpp>             // bit_set
+#include <boost/mp11/list.hpp>          // mp_list
+#include <boost/test/unit_test.hpp>     // BOOST_AUTO_TEST_SUITE, BOOST_AUTO_TEST_SUITE_END, BOOST_AUTO_TEST_CASE, BOOST_AUTO_TEST_CASE_TEMPLATE, BOOST_CHECK, BOOST_CHECK_EQUAL
+#include <algorithm>                    // max
+#include <cstddef>                      // size_t
+#include <cstdint>                      // uint8_t, uint16_t, uint32_t, uint64_t
+#include <functional>                   // hash
+#include <random>                       // mt19937_64
+#include <ranges>                       // iota
+
+BOOST_AUTO_TEST_SUITE(ZobristBitSet)
+
+using namespace xstd;
+
+using Types = boost::mp11::mp_list
+<       zobrist_bit_set<  0, uint8_t>
+,       zobrist_bit_set<  1, uint8_t>
+,       zobrist_bit_set< 20, uint8_t>
+,       zobrist_bit_set< 64, uint16_t>
+,       zobrist_bit_set<100, uint32_t>
+,       zobrist_bit_set<300, uint64_t>
+>;
+
+// The hash of z, recomputed from scratch.
+template<class T>
+auto rehash(T const& z)
+{
+        return T(z.set()).hash();
+}
+
+// Random sequences of all mutations, each checked against the same
+// mutation of a plain bit_set and against the hash recomputed from scratch.
+BOOST_AUTO_TEST_CASE_TEMPLATE(Mutations, T, Types)
+{
+        using S = typename T::set_type;
+        constexpr auto N = S::max_size();
+        auto urbg = std::mt19937_64(N);
+        auto z = T();
+        auto s = S();
+        auto other = T(random_set<S>(urbg, urbg() % 17));
+        BOOST_CHECK_EQUAL(z.hash(), 0);
+        for ([[maybe_unused]] auto _ : std::views::iota(0, 2000)) {
+                auto const x = urbg() % std::max(N, 1uz);
+                switch (urbg() % 12) {
+                case  0: if constexpr (N > 0) { BOOST_CHECK_EQUAL(z.insert(x), s.insert(x).second); } break;
+                case  1: if constexpr (N > 0) { BOOST_CHECK_EQUAL(z.erase(x), s.erase(x));          } break;
+                case  2: if constexpr (N > 0) { z.complement(x); s.complement(x);                     } break;
+                case  3: z.complement(); s.complement(); break;
+                case  4: if (urbg() % 8 == 0) { z.clear(); s.clear(); } break;
+                case  5: if (urbg() % 8 == 0) { z.fill();  s.fill();  } break;
+                case  6: { auto const m = random_set<S>(urbg, urbg() % 17); z &= m; s &= m; break; }
+                case  7: { auto const m = random_set<S>(urbg, urbg() % 17); z |= m; s |= m; break; }
+                case  8: { auto const m = random_set<S>(urbg, urbg() % 17); z ^= m; s ^= m; break; }
+                case  9: { auto const m = random_set<S>(urbg, urbg() % 17); z -= m; s -= m; break; }
+                case 10: {
+                        swap(z, other);
+                        BOOST_CHECK(other.set() == s);
+                        BOOST_CHECK_EQUAL(other.hash(), rehash(other));
+                        s = z.set();
+                        break;
+                }
+                default: if constexpr (N > 0) { BOOST_CHECK_EQUAL(z.contains(x), s.contains(x)); } break;
+                }
+                BOOST_CHECK(z.set() == s);
+                BOOST_CHECK_EQUAL(z.size(), s.size());
+                BOOST_CHECK_EQUAL(z.empty(), s.empty());
+                BOOST_CHECK_EQUAL(z.hash(), rehash(z));
+                BOOST_CHECK_EQUAL(std::hash<T>()(z), z.hash());
+        }
+}
+
+// The hash only depends on the elements, not on the way the set was built.
+BOOST_AUTO_TEST_CASE(PathIndependent)
+{
+        auto x = zobrist_bit_set<100>();
+        x.insert(3);
+        x.insert(50);
+        x.insert(99);
+        auto y = zobrist_bit_set<100>();
+        y.fill();
+        y &= bit_set<100>{ 3, 50, 99, 7 };
+        y.erase(7);
+        BOOST_CHECK(x == y);
+        BOOST_CHECK_EQUAL(x.hash(), y.hash());
+        BOOST_CHECK(x.hash() != zobrist_bit_set<100>().hash());
+}
+
+BOOST_AUTO_TEST_CASE(Constexpr)
+{
+        static_assert([]() {
+                auto z = zobrist_bit_set<70>();
+                z.insert(1);
+                z.insert(69);
+                z |= bit_set<70>{ 2, 69 };
+                z.complement(1);
+                return z.hash() == (zobrist::keys<70>[2] ^ zobrist::keys<70>[69]);
+        }());
+}
+
+BOOST_AUTO_TEST_SUITE_END()